@@ -105,6 +105,7 @@ option(WITH_DYNAMIC_LINKING "Enable dynamic library linking."
 option(WITH_STRICT_DATABASE_TYPE_CHECKS "Enable strict checking of database field value accessors" 0)
 option(WITHOUT_METRICS     "Disable metrics reporting (i.e. InfluxDB and Grafana)"       0)
 option(WITH_DETAILED_METRICS  "Enable detailed metrics reporting (i.e. time each session takes to update)" 0)
+set(LOG_COMPILE_LEVEL      "7" CACHE STRING "Most verbose log level compiled in, from 1 (Fatal) to 7 (Trace). 5 removes all debug and trace logging")
 
 CheckApplicationsBuildList()
 CheckToolsBuildList()
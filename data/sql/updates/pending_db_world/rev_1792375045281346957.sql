@@ -0,0 +1,5 @@
+--
+DELETE FROM `command` WHERE `name` IN ('debug spellbench', 'debug spellprofile');
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('debug spellbench', 3, 'Syntax: .debug spellbench $count $spell [$spell...]\nCasts the spell sequence $count times (triggered) from you on the selected unit and reports the time per cast and per spell/aura effect handler.'),
+('debug spellprofile', 3, 'Syntax: .debug spellprofile [on/off]\nStarts (and resets) or stops timing of spell and aura effect handlers on all maps. Without argument shows the collected timings.');
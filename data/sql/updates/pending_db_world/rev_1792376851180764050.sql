@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name` = 'debug configbench';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('debug configbench', 3, 'Syntax: .debug configbench [$count]\nReads three combat options $count times (default 100000, at most 1000000) by name and through the typed option handles and reports the time per read.');
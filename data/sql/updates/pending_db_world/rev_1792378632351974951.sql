@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name` = 'debug opcodeprofile';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('debug opcodeprofile', 3, 'Syntax: .debug opcodeprofile [on/off]\nStarts (and resets) or stops timing of client opcode handlers. Without argument shows the collected timings and where each handler is processed (world, map, parallel or inplace).');
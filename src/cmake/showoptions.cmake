@@ -174,6 +174,13 @@ elseif (WITH_DETAILED_METRICS)
   add_definitions(-DWITH_DETAILED_METRICS)
 endif()
 
+if (LOG_COMPILE_LEVEL AND LOG_COMPILE_LEVEL LESS 7)
+  message("")
+  message(" *** LOG_COMPILE_LEVEL - WARNING!")
+  message(" *** Log calls more verbose than level ${LOG_COMPILE_LEVEL} are removed from the build")
+  add_definitions(-DWARHEAD_LOG_COMPILE_LEVEL=${LOG_COMPILE_LEVEL})
+endif()
+
 if (ASAN)
   message("")
   message(" *** ASAN - WARNING!")
@@ -22,12 +22,22 @@
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
+#include <algorithm>
+#include <bit>
 #include <cstring>
 #include <stdexcept>
 #include <vector>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BIH_USE_SSE2
+#include <emmintrin.h>
+#endif
+
 #define MAX_STACK_SIZE 64
 
+// Number of rays traversed together by BIH::intersectRays, matches the SSE register width
+constexpr uint32 BIH_RAY_PACKET_SIZE = 4;
+
 // https://stackoverflow.com/a/4328396
 
 static inline uint32 floatToRawIntBits(float f)
@@ -275,6 +285,21 @@ public:
         }
     }
 
+    /**
+    Batched version of intersectRay.
+    Rays are traversed in packets of BIH_RAY_PACKET_SIZE, so every tree node reached by at least one ray
+    of the packet is fetched and clip-tested once for all of them. Callback gets the index of the ray in the batch:
+    bool intersectCallback(uint32 rayIndex, G3D::Ray const& ray, uint32 entry, float& maxDist, bool stopAtFirstHit)
+    */
+    template<typename RayCallback>
+    void intersectRays(G3D::Ray const* rays, float* maxDists, uint32 count, RayCallback& intersectCallback, bool stopAtFirstHit) const
+    {
+        for (uint32 first = 0; first < count; first += BIH_RAY_PACKET_SIZE)
+        {
+            intersectRayPacket(first, rays + first, maxDists + first, std::min(count - first, BIH_RAY_PACKET_SIZE), intersectCallback, stopAtFirstHit);
+        }
+    }
+
     template<typename IsectCallback>
     void intersectPoint(const G3D::Vector3& p, IsectCallback& intersectCallback) const
     {
@@ -412,6 +437,327 @@ protected:
         void printStats();
     };
 
+    struct PacketStackNode
+    {
+        uint32 node;
+        uint32 mask;
+        alignas(16) float tnear[BIH_RAY_PACKET_SIZE];
+        alignas(16) float tfar[BIH_RAY_PACKET_SIZE];
+    };
+
+    struct RayPacket
+    {
+        alignas(16) float org[3][BIH_RAY_PACKET_SIZE];
+        alignas(16) float invDir[3][BIH_RAY_PACKET_SIZE];
+        alignas(16) float negDir[3][BIH_RAY_PACKET_SIZE]; // all bits set when direction sign bit is set
+        uint32 negDirMask[3];                               // lanes with the direction sign bit set, per axis
+        alignas(16) float tnear[BIH_RAY_PACKET_SIZE];
+        alignas(16) float tfar[BIH_RAY_PACKET_SIZE];
+    };
+
+    /**
+    Clip the packet intervals [tnear, tfar] against an interior node with planes clipL (left child max) and clipR (right child min).
+    Follows the same near/far child rules as the single ray traversal. Returns the lane masks of rays entering each child.
+    */
+    static void clipPacketInterior(RayPacket const& packet, uint32 axis, float clipL, float clipR,
+        float* leftNear, float* leftFar, float* rightNear, float* rightFar, uint32& leftMask, uint32& rightMask)
+    {
+#if defined(BIH_USE_SSE2)
+        __m128 org = _mm_load_ps(packet.org[axis]);
+        __m128 invDir = _mm_load_ps(packet.invDir[axis]);
+        __m128 neg = _mm_load_ps(packet.negDir[axis]);
+        __m128 tnear = _mm_load_ps(packet.tnear);
+        __m128 tfar = _mm_load_ps(packet.tfar);
+        __m128 tl = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(clipL), org), invDir);
+        __m128 tr = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(clipR), org), invDir);
+        // NaN clip distances keep the current interval, like the scalar comparisons do
+        __m128 enterL = _mm_max_ps(tl, tnear);
+        __m128 exitL = _mm_min_ps(tl, tfar);
+        __m128 enterR = _mm_max_ps(tr, tnear);
+        __m128 exitR = _mm_min_ps(tr, tfar);
+        // positive direction: left is the near child, negative direction: right is the near child
+        __m128 lNear = _mm_or_ps(_mm_and_ps(neg, enterL), _mm_andnot_ps(neg, tnear));
+        __m128 lFar = _mm_or_ps(_mm_and_ps(neg, tfar), _mm_andnot_ps(neg, exitL));
+        __m128 rNear = _mm_or_ps(_mm_and_ps(neg, tnear), _mm_andnot_ps(neg, enterR));
+        __m128 rFar = _mm_or_ps(_mm_and_ps(neg, exitR), _mm_andnot_ps(neg, tfar));
+        _mm_store_ps(leftNear, lNear);
+        _mm_store_ps(leftFar, lFar);
+        _mm_store_ps(rightNear, rNear);
+        _mm_store_ps(rightFar, rFar);
+        leftMask = uint32(_mm_movemask_ps(_mm_cmple_ps(lNear, lFar)));
+        rightMask = uint32(_mm_movemask_ps(_mm_cmple_ps(rNear, rFar)));
+#else
+        leftMask = 0;
+        rightMask = 0;
+        for (uint32 i = 0; i < BIH_RAY_PACKET_SIZE; ++i)
+        {
+            float tl = (clipL - packet.org[axis][i]) * packet.invDir[axis][i];
+            float tr = (clipR - packet.org[axis][i]) * packet.invDir[axis][i];
+            float tnear = packet.tnear[i];
+            float tfar = packet.tfar[i];
+            if (floatToRawIntBits(packet.negDir[axis][i]))
+            {
+                leftNear[i] = (tl >= tnear) ? tl : tnear;
+                leftFar[i] = tfar;
+                rightNear[i] = tnear;
+                rightFar[i] = (tr <= tfar) ? tr : tfar;
+            }
+            else
+            {
+                leftNear[i] = tnear;
+                leftFar[i] = (tl <= tfar) ? tl : tfar;
+                rightNear[i] = (tr >= tnear) ? tr : tnear;
+                rightFar[i] = tfar;
+            }
+            leftMask |= uint32(leftNear[i] <= leftFar[i]) << i;
+            rightMask |= uint32(rightNear[i] <= rightFar[i]) << i;
+        }
+#endif
+    }
+
+    /// Clip the packet intervals in place against a BVH2 node (empty space cut off on both sides), returns lanes still inside
+    static uint32 clipPacketBVH2(RayPacket& packet, uint32 axis, float clipL, float clipR)
+    {
+#if defined(BIH_USE_SSE2)
+        __m128 org = _mm_load_ps(packet.org[axis]);
+        __m128 invDir = _mm_load_ps(packet.invDir[axis]);
+        __m128 neg = _mm_load_ps(packet.negDir[axis]);
+        __m128 tl = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(clipL), org), invDir);
+        __m128 tr = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(clipR), org), invDir);
+        __m128 tf = _mm_or_ps(_mm_and_ps(neg, tr), _mm_andnot_ps(neg, tl));
+        __m128 tb = _mm_or_ps(_mm_and_ps(neg, tl), _mm_andnot_ps(neg, tr));
+        __m128 tnear = _mm_max_ps(tf, _mm_load_ps(packet.tnear));
+        __m128 tfar = _mm_min_ps(tb, _mm_load_ps(packet.tfar));
+        _mm_store_ps(packet.tnear, tnear);
+        _mm_store_ps(packet.tfar, tfar);
+        return uint32(_mm_movemask_ps(_mm_cmple_ps(tnear, tfar)));
+#else
+        uint32 mask = 0;
+        for (uint32 i = 0; i < BIH_RAY_PACKET_SIZE; ++i)
+        {
+            bool neg = floatToRawIntBits(packet.negDir[axis][i]) != 0;
+            float tf = ((neg ? clipR : clipL) - packet.org[axis][i]) * packet.invDir[axis][i];
+            float tb = ((neg ? clipL : clipR) - packet.org[axis][i]) * packet.invDir[axis][i];
+            packet.tnear[i] = (tf >= packet.tnear[i]) ? tf : packet.tnear[i];
+            packet.tfar[i] = (tb <= packet.tfar[i]) ? tb : packet.tfar[i];
+            mask |= uint32(packet.tnear[i] <= packet.tfar[i]) << i;
+        }
+        return mask;
+#endif
+    }
+
+    template<typename RayCallback>
+    void intersectRayPacket(uint32 firstIndex, G3D::Ray const* rays, float* maxDists, uint32 count, RayCallback& intersectCallback, bool stopAtFirstHit) const
+    {
+        RayPacket packet;
+        packet.negDirMask[0] = packet.negDirMask[1] = packet.negDirMask[2] = 0;
+        uint32 mask = 0;
+        for (uint32 i = 0; i < BIH_RAY_PACKET_SIZE; ++i)
+        {
+            // unused lanes get an empty interval and are never part of the mask
+            packet.tnear[i] = 1.f;
+            packet.tfar[i] = 0.f;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                packet.org[axis][i] = 0.f;
+                packet.invDir[axis][i] = 0.f;
+                packet.negDir[axis][i] = 0.f;
+            }
+
+            if (i >= count)
+            {
+                continue;
+            }
+
+            // root bounds test, identical to intersectRay
+            G3D::Vector3 const& org = rays[i].origin();
+            G3D::Vector3 const& dir = rays[i].direction();
+            float intervalMin = -1.f;
+            float intervalMax = -1.f;
+            bool miss = false;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                packet.org[axis][i] = org[axis];
+                packet.invDir[axis][i] = 1.f / dir[axis];
+                packet.negDir[axis][i] = intBitsToFloat((floatToRawIntBits(dir[axis]) >> 31) ? 0xFFFFFFFF : 0);
+                packet.negDirMask[axis] |= (floatToRawIntBits(dir[axis]) >> 31) << i;
+                if (G3D::fuzzyNe(dir[axis], 0.0f))
+                {
+                    float t1 = (bounds.low()[axis] - org[axis]) * packet.invDir[axis][i];
+                    float t2 = (bounds.high()[axis] - org[axis]) * packet.invDir[axis][i];
+                    if (t1 > t2)
+                    {
+                        std::swap(t1, t2);
+                    }
+                    if (t1 > intervalMin)
+                    {
+                        intervalMin = t1;
+                    }
+                    if (t2 < intervalMax || intervalMax < 0.f)
+                    {
+                        intervalMax = t2;
+                    }
+                    if (intervalMax <= 0 || intervalMin >= maxDists[i])
+                    {
+                        miss = true;
+                    }
+                }
+            }
+
+            if (miss || intervalMin > intervalMax)
+            {
+                continue;
+            }
+
+            packet.tnear[i] = std::max(intervalMin, 0.f);
+            packet.tfar[i] = std::min(intervalMax, maxDists[i]);
+            mask |= 1 << i;
+        }
+
+        if (!mask)
+        {
+            return;
+        }
+
+        uint32 finished = 0; // lanes that already found their first hit
+        PacketStackNode stack[MAX_STACK_SIZE];
+        int stackPos = 0;
+        int node = 0;
+        alignas(16) float leftNear[BIH_RAY_PACKET_SIZE];
+        alignas(16) float leftFar[BIH_RAY_PACKET_SIZE];
+        alignas(16) float rightNear[BIH_RAY_PACKET_SIZE];
+        alignas(16) float rightFar[BIH_RAY_PACKET_SIZE];
+
+        while (true)
+        {
+            while (mask)
+            {
+                uint32 tn = tree[node];
+                uint32 axis = (tn & (3 << 30)) >> 30;
+                bool BVH2 = tn & (1 << 29);
+                int offset = tn & ~(7 << 29);
+                if (!BVH2)
+                {
+                    if (axis < 3)
+                    {
+                        // "normal" interior node
+                        uint32 leftMask, rightMask;
+                        clipPacketInterior(packet, axis, intBitsToFloat(tree[node + 1]), intBitsToFloat(tree[node + 2]),
+                            leftNear, leftFar, rightNear, rightFar, leftMask, rightMask);
+                        leftMask &= mask;
+                        rightMask &= mask;
+                        if (!leftMask && !rightMask)
+                        {
+                            break;
+                        }
+
+                        if (leftMask && rightMask)
+                        {
+                            // packet splits, visit the child that is near for most of its rays first
+                            // and remember the far one for later
+                            uint32 splitMask = leftMask | rightMask;
+                            bool rightIsNear = std::popcount(packet.negDirMask[axis] & splitMask) * 2 > std::popcount(splitMask);
+
+                            PacketStackNode& entry = stack[stackPos++];
+                            if (rightIsNear)
+                            {
+                                entry.node = offset;
+                                entry.mask = leftMask;
+                                std::copy(std::begin(leftNear), std::end(leftNear), std::begin(entry.tnear));
+                                std::copy(std::begin(leftFar), std::end(leftFar), std::begin(entry.tfar));
+                                leftMask = 0;
+                            }
+                            else
+                            {
+                                entry.node = offset + 3;
+                                entry.mask = rightMask;
+                                std::copy(std::begin(rightNear), std::end(rightNear), std::begin(entry.tnear));
+                                std::copy(std::begin(rightFar), std::end(rightFar), std::begin(entry.tfar));
+                                rightMask = 0;
+                            }
+                        }
+
+                        if (leftMask)
+                        {
+                            node = offset;
+                            mask = leftMask;
+                            std::copy(std::begin(leftNear), std::end(leftNear), std::begin(packet.tnear));
+                            std::copy(std::begin(leftFar), std::end(leftFar), std::begin(packet.tfar));
+                        }
+                        else
+                        {
+                            node = offset + 3;
+                            mask = rightMask;
+                            std::copy(std::begin(rightNear), std::end(rightNear), std::begin(packet.tnear));
+                            std::copy(std::begin(rightFar), std::end(rightFar), std::begin(packet.tfar));
+                        }
+                        continue;
+                    }
+                    else
+                    {
+                        // leaf - test some objects against every ray still in the packet
+                        int n = tree[node + 1];
+                        for (uint32 i = 0; i < BIH_RAY_PACKET_SIZE && n > 0; ++i)
+                        {
+                            if (!(mask & (1 << i)))
+                            {
+                                continue;
+                            }
+
+                            for (int k = 0; k < n; ++k)
+                            {
+                                bool hit = intersectCallback(firstIndex + i, rays[i], objects[offset + k], maxDists[i], stopAtFirstHit);
+                                if (stopAtFirstHit && hit)
+                                {
+                                    finished |= 1 << i;
+                                    break;
+                                }
+                            }
+                        }
+                        break;
+                    }
+                }
+                else
+                {
+                    if (axis > 2)
+                    {
+                        return;    // should not happen
+                    }
+                    mask &= clipPacketBVH2(packet, axis, intBitsToFloat(tree[node + 1]), intBitsToFloat(tree[node + 2]));
+                    node = offset;
+                }
+            } // traversal loop
+
+            do
+            {
+                // stack is empty?
+                if (stackPos == 0)
+                {
+                    return;
+                }
+                // move back up the stack
+                stackPos--;
+                PacketStackNode const& entry = stack[stackPos];
+                mask = entry.mask & ~finished;
+                for (uint32 i = 0; i < BIH_RAY_PACKET_SIZE; ++i)
+                {
+                    if ((mask & (1 << i)) && maxDists[i] < entry.tnear[i])
+                    {
+                        mask &= ~(1 << i);
+                    }
+                }
+                if (!mask)
+                {
+                    continue;
+                }
+                node = entry.node;
+                std::copy(std::begin(entry.tnear), std::end(entry.tnear), std::begin(packet.tnear));
+                std::copy(std::begin(entry.tfar), std::end(entry.tfar), std::begin(packet.tfar));
+                break;
+            } while (true);
+        }
+    }
+
     void buildHierarchy(std::vector<uint32>& tempTree, buildData& dat, BuildStats& stats);
 
     void createNode(std::vector<uint32>& tempTree, int nodeIndex, uint32 left, uint32 right) const
@@ -22,6 +22,11 @@
 #include "Optional.h"
 #include <string>
 
+namespace G3D
+{
+    class Vector3;
+}
+
 constexpr auto VMAP_INVALID_HEIGHT       = -100000.0f;  // for check
 constexpr auto VMAP_INVALID_HEIGHT_VALUE = -200000.0f;  // real assigned value in unknown height case
 
@@ -88,6 +93,11 @@ namespace VMAP
         virtual bool isInLineOfSight(unsigned int pMapId, float x1, float y1, float z1, float x2, float y2, float z2, ModelIgnoreFlags ignoreFlags) = 0;
         virtual float getHeight(unsigned int pMapId, float x, float y, float z, float maxSearchDist) = 0;
         /**
+        batched line of sight query, positions are in world coordinates
+        results[i] matches what the single segment version would return for element i
+        */
+        virtual void isInLineOfSight(unsigned int pMapId, G3D::Vector3 const* starts, G3D::Vector3 const* ends, bool* results, uint32 count, ModelIgnoreFlags ignoreFlags) = 0;
+        /**
         test if we hit an object. return true if we hit one. rx, ry, rz will hold the hit position or the dest position, if no intersection was found
         return a position, that is pReduceDist closer to the origin
         */
@@ -26,7 +26,9 @@
 #include "ModelInstance.h"
 #include "WorldModel.h"
 #include <G3D/Vector3.h>
+#include <algorithm>
 #include <iomanip>
+#include <memory>
 #include <string>
 
 using G3D::Vector3;
@@ -196,6 +198,55 @@ namespace VMAP
         return true;
     }
 
+    void VMapMgr2::isInLineOfSight(unsigned int mapId, Vector3 const* starts, Vector3 const* ends, bool* results, uint32 count, ModelIgnoreFlags ignoreFlags)
+    {
+        std::fill(results, results + count, true);
+
+#if defined(ENABLE_VMAP_CHECKS)
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+        {
+            return;
+        }
+#endif
+
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+        {
+            return;
+        }
+
+        std::vector<Vector3> pos1, pos2;
+        std::vector<uint32> indexes;
+        pos1.reserve(count);
+        pos2.reserve(count);
+        indexes.reserve(count);
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            Vector3 start = convertPositionToInternalRep(starts[i].x, starts[i].y, starts[i].z);
+            Vector3 end = convertPositionToInternalRep(ends[i].x, ends[i].y, ends[i].z);
+            if (start != end)
+            {
+                pos1.push_back(start);
+                pos2.push_back(end);
+                indexes.push_back(i);
+            }
+        }
+
+        if (indexes.empty())
+        {
+            return;
+        }
+
+        std::unique_ptr<bool[]> treeResults = std::make_unique<bool[]>(indexes.size());
+        instanceTree->second->isInLineOfSight(pos1.data(), pos2.data(), treeResults.get(), indexes.size(), ignoreFlags);
+
+        for (std::size_t i = 0; i < indexes.size(); ++i)
+        {
+            results[indexes[i]] = treeResults[i];
+        }
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
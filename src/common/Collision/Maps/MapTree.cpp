@@ -52,6 +52,25 @@ namespace VMAP
         bool hit;
     };
 
+    class MapRayBatchCallback
+    {
+    public:
+        MapRayBatchCallback(ModelInstance* val, ModelIgnoreFlags ignoreFlags, std::vector<bool>& hits): prims(val), flags(ignoreFlags), hits(hits) { }
+        bool operator()(uint32 rayIndex, const G3D::Ray& ray, uint32 entry, float& distance, bool StopAtFirstHit)
+        {
+            bool result = prims[entry].intersectRay(ray, distance, StopAtFirstHit, flags);
+            if (result)
+            {
+                hits[rayIndex] = true;
+            }
+            return result;
+        }
+    protected:
+        ModelInstance* prims;
+        ModelIgnoreFlags flags;
+        std::vector<bool>& hits;
+    };
+
     class AreaInfoCallback
     {
     public:
@@ -187,6 +206,60 @@ namespace VMAP
     }
     //=========================================================
     /**
+    Batched isInLineOfSight, all segments are traversed through the tree together.
+    results[i] gets the line of sight state between pos1[i] and pos2[i]
+    */
+
+    void StaticMapTree::isInLineOfSight(const Vector3* pos1, const Vector3* pos2, bool* results, uint32 count, ModelIgnoreFlags ignoreFlags) const
+    {
+        std::vector<G3D::Ray> rays;
+        std::vector<float> maxDists;
+        std::vector<uint32> indexes;
+        rays.reserve(count);
+        maxDists.reserve(count);
+        indexes.reserve(count);
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            float maxDist = (pos2[i] - pos1[i]).magnitude();
+            // same special cases as the single segment version
+            if (maxDist == std::numeric_limits<float>::max() || !std::isfinite(maxDist))
+            {
+                results[i] = false;
+                continue;
+            }
+
+            ASSERT(maxDist < std::numeric_limits<float>::max());
+            results[i] = true;
+            if (maxDist < 1e-10f)
+            {
+                continue;
+            }
+
+            rays.push_back(G3D::Ray::fromOriginAndDirection(pos1[i], (pos2[i] - pos1[i]) / maxDist));
+            maxDists.push_back(maxDist);
+            indexes.push_back(i);
+        }
+
+        if (rays.empty())
+        {
+            return;
+        }
+
+        std::vector<bool> hits(rays.size(), false);
+        MapRayBatchCallback intersectionCallBack(iTreeValues, ignoreFlags, hits);
+        iTree.intersectRays(rays.data(), maxDists.data(), rays.size(), intersectionCallBack, true);
+
+        for (std::size_t i = 0; i < indexes.size(); ++i)
+        {
+            if (hits[i])
+            {
+                results[indexes[i]] = false;
+            }
+        }
+    }
+    //=========================================================
+    /**
     When moving from pos1 to pos2 check if we hit an object. Return true and the position if we hit one
     Return the hit pos or the original dest pos
     */
@@ -31,6 +31,7 @@
 #include <regex>
 
 constexpr auto MIN_OPTIONS = 4;
+constexpr auto MAX_OPEN_DYNAMIC_FILES = 64;
 constexpr auto LOG_TIMESTAMP_FMT = "%Y_%m_%d_%H_%M_%S";
 
 namespace fs = std::filesystem;
@@ -200,26 +201,67 @@ void Warhead::FileChannel::Write(LogMessage const& msg)
     if (_isDynamicFileName)
     {
         // Get name for dymamic file
-        _fileName = fmt::format(_fileName, msg.GetOption());
+        std::string fileName = fmt::format(_fileName, msg.GetOption());
 
-        if (!OpenFile())
-            throw Exception("Cannot open file '{}'", _fileName);
+        std::ofstream* file = GetDynamicFile(fileName);
+        if (!file)
+            throw Exception("Cannot open file '{}'", fileName);
+
+        *file << text << '\n';
+
+        if (!_isBuffered)
+            file->flush();
+
+        if (!file->good())
+            throw Exception("Incorrect write to file '{}'", fileName);
 
-        *_logFile << text << std::endl;
-        CloseFile();
         return;
     }
 
     if (!OpenFile())
         throw Exception("Cannot open file '{}'", _fileName);
 
-    *_logFile << text;
-    _isFlush ? *_logFile << std::endl : *_logFile << "\n";
+    *_logFile << text << '\n';
+
+    if (_isFlush && !_isBuffered)
+        _logFile->flush();
 
     if (!_logFile->good())
         throw Exception("Incorrect write to file '{}'", _fileName);
 }
 
+void Warhead::FileChannel::Flush()
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+
+    if (_logFile)
+        _logFile->flush();
+
+    for (auto const& [fileName, file] : _dynamicFiles)
+        file->flush();
+}
+
+std::ofstream* Warhead::FileChannel::GetDynamicFile(std::string const& fileName)
+{
+    auto itr = _dynamicFiles.find(fileName);
+    if (itr != _dynamicFiles.end())
+        return itr->second.get();
+
+    // Plenty for the usual per account files, close them all rather than tracking their use
+    if (_dynamicFiles.size() >= MAX_OPEN_DYNAMIC_FILES)
+        _dynamicFiles.clear();
+
+    std::ios::openmode openMode = std::ios::out;
+    if (_isOpenModeAppend)
+        openMode |= std::ios_base::app;
+
+    auto file = std::make_unique<std::ofstream>(_logsDir + fileName, openMode);
+    if (!file->is_open())
+        return nullptr;
+
+    return _dynamicFiles.emplace(fileName, std::move(file)).first->second.get();
+}
+
 bool Warhead::FileChannel::OpenFile()
 {
     if (_logFile)
@@ -20,6 +20,7 @@
 
 #include "LogChannel.h"
 #include <mutex>
+#include <unordered_map>
 
 namespace Warhead
 {
@@ -32,15 +33,18 @@ namespace Warhead
         ~FileChannel() override;
 
         void Write(LogMessage const& msg) override;
+        void Flush() override;
 
     private:
         bool OpenFile();
         void CloseFile();
         void ClearOldFiles();
+        std::ofstream* GetDynamicFile(std::string const& fileName);
 
         std::string _logsDir;
         std::string _fileName;
         std::unique_ptr<std::ofstream> _logFile;
+        std::unordered_map<std::string, std::unique_ptr<std::ofstream>> _dynamicFiles; // kept open between messages
         bool _isDynamicFileName{ false };
         bool _isFlush{ true };
         bool _isOpenModeAppend{ true };
@@ -27,8 +27,11 @@
 #include "FileUtil.h"
 #include "LogMessage.h"
 #include "Logger.h"
+#include "MPSCQueue.h"
 #include "StringConvert.h"
 #include "Tokenize.h"
+#include <condition_variable>
+#include <thread>
 
 namespace
 {
@@ -42,6 +45,37 @@ namespace
     constexpr auto PREFIX_CHANNEL = "LogChannel.";
     constexpr auto PREFIX_LOGGER_LENGTH = 7;
     constexpr auto PREFIX_CHANNEL_LENGTH = 11;
+
+    // Producers blocked on a full queue are woken up at least every this many written messages
+    constexpr std::size_t ASYNC_WAKE_UP_STEP = 512;
+
+    enum class AsyncOverflowPolicy : uint8
+    {
+        Drop,
+        Block
+    };
+}
+
+namespace Warhead
+{
+    struct AsyncLogQueue
+    {
+        MPSCQueue<LogMessage> Queue;
+        std::atomic<std::size_t> Size{ 0 };
+        std::atomic<uint64> Written{ 0 };
+        std::atomic<uint64> Dropped{ 0 };
+        std::atomic<bool> Stop{ false };
+
+        std::size_t MaxSize{ 100000 };
+        std::size_t FlushSize{ 1000 };
+        Milliseconds FlushInterval{ 1s };
+        AsyncOverflowPolicy OverflowPolicy{ AsyncOverflowPolicy::Drop };
+
+        std::mutex Lock;
+        std::condition_variable WriterWakeUp;
+        std::condition_variable SpaceAvailable;
+        std::thread Writer;
+    };
 }
 
 Warhead::Log::Log()
@@ -52,6 +86,7 @@ Warhead::Log::Log()
 
 Warhead::Log::~Log()
 {
+    StopAsync();
     Clear();
 }
 
@@ -66,6 +101,7 @@ void Warhead::Log::Clear()
     // Clear all loggers and channels
     _loggers.clear();
     _channels.clear();
+    ++_loggersGeneration;
 }
 
 void Warhead::Log::Initialize()
@@ -85,10 +121,153 @@ void Warhead::Log::LoadFromConfig()
 
     ASSERT(Warhead::File::CreateDirIfNeed(_logsDir));
 
+    // Write out everything queued for the old channels before they are replaced
+    StopAsync();
+
     Clear();
     //InitLogsDir();
     ReadChannelsFromConfig();
     ReadLoggersFromConfig();
+    ++_loggersGeneration;
+
+    if (sConfigMgr->GetOption<bool>("Log.Async.Enable", false))
+        StartAsync();
+}
+
+void Warhead::Log::StartAsync()
+{
+    auto async = std::make_unique<AsyncLogQueue>();
+    async->MaxSize = std::max<std::size_t>(sConfigMgr->GetOption<uint32>("Log.Async.QueueSize", 100000), 1);
+    async->FlushSize = std::clamp<std::size_t>(sConfigMgr->GetOption<uint32>("Log.Async.FlushSize", 1000), 1, async->MaxSize);
+    async->FlushInterval = Milliseconds(std::max<uint32>(sConfigMgr->GetOption<uint32>("Log.Async.FlushInterval", 1000), 10));
+
+    if (sConfigMgr->GetOption<uint32>("Log.Async.OverflowPolicy", 0))
+        async->OverflowPolicy = AsyncOverflowPolicy::Block;
+
+    for (auto const& [name, channel] : _channels)
+        channel->SetBuffered(true);
+
+    async->Writer = std::thread(&Log::AsyncWriterThread, this, async.get());
+
+    std::unique_lock<std::shared_mutex> guard(_asyncLock);
+    _async = std::move(async);
+}
+
+void Warhead::Log::StopAsync()
+{
+    if (!_async)
+        return;
+
+    // From here on new messages are written directly, blocked producers wake up and do the same
+    {
+        std::lock_guard<std::mutex> guard(_async->Lock);
+        _async->Stop = true;
+        _async->WriterWakeUp.notify_one();
+        _async->SpaceAvailable.notify_all();
+    }
+
+    if (_async->Writer.joinable())
+        _async->Writer.join();
+
+    // Wait for producers that are still queueing a message, then write out what they left
+    std::unique_ptr<AsyncLogQueue> async;
+    {
+        std::unique_lock<std::shared_mutex> guard(_asyncLock);
+        async = std::move(_async);
+    }
+
+    WriteAsyncQueue(*async);
+
+    for (auto const& [name, channel] : _channels)
+        channel->SetBuffered(false);
+}
+
+void Warhead::Log::AsyncWriterThread(AsyncLogQueue* async)
+{
+    for (;;)
+    {
+        bool stop = false;
+
+        {
+            std::unique_lock<std::mutex> lock(async->Lock);
+            async->WriterWakeUp.wait_for(lock, async->FlushInterval, [async]()
+            {
+                return async->Stop || async->Size >= async->FlushSize;
+            });
+
+            stop = async->Stop;
+        }
+
+        // Messages queued before the stop request are still written
+        WriteAsyncQueue(*async);
+
+        if (stop)
+            break;
+    }
+}
+
+void Warhead::Log::WriteAsyncQueue(AsyncLogQueue& async)
+{
+    // Producers check the queue size under the lock, so waking them under it can't get lost
+    auto notifySpaceAvailable = [&async]()
+    {
+        std::lock_guard<std::mutex> guard(async.Lock);
+        async.SpaceAvailable.notify_all();
+    };
+
+    LogMessage* message = nullptr;
+    std::size_t count = 0;
+
+    while (async.Queue.Dequeue(message))
+    {
+        std::unique_ptr<LogMessage> msg{ message };
+        msg->FormatText();
+        WriteMessage(*msg);
+
+        --async.Size;
+
+        if (!(++count % ASYNC_WAKE_UP_STEP))
+            notifySpaceAvailable();
+    }
+
+    notifySpaceAvailable();
+
+    if (!count)
+        return;
+
+    async.Written += count;
+
+    FlushChannels();
+}
+
+void Warhead::Log::FlushChannels()
+{
+    for (auto const& [name, channel] : _channels)
+    {
+        try
+        {
+            channel->Flush();
+        }
+        catch (const Exception& e)
+        {
+            fmt::print("Error at flush: {}", e.GetErrorMessage());
+        }
+    }
+}
+
+bool Warhead::Log::IsAsync() const
+{
+    std::shared_lock<std::shared_mutex> guard(_asyncLock);
+    return _async != nullptr;
+}
+
+Warhead::Log::AsyncStats Warhead::Log::GetAsyncStats() const
+{
+    std::shared_lock<std::shared_mutex> guard(_asyncLock);
+    if (!_async)
+        return {};
+
+    return { _async->Written, _async->Dropped, _async->Size };
 }
 
 void Warhead::Log::ReadLoggersFromConfig()
@@ -265,6 +444,7 @@ void Warhead::Log::UsingDefaultLogs(bool value /*= true*/)
         auto rootLogger = std::make_unique<Logger>("root", highestLogLevel);
         rootLogger->AddChannel(consoleChannel);
         _loggers.emplace("root", std::move(rootLogger));
+        ++_loggersGeneration;
     }
     catch (const Exception& e)
     {
@@ -320,11 +500,39 @@ bool Warhead::Log::ShouldLog(std::string_view filter, LogLevel const level)
     return logLevel != LogLevel::Disabled && logLevel >= level;
 }
 
+bool Warhead::Log::ShouldLogCached(LogCallSite& callSite, std::string_view filter, LogLevel level)
+{
+    Logger* logger = nullptr;
+    uint32 generation = _loggersGeneration.load(std::memory_order_acquire);
+
+    if (callSite._generation.load(std::memory_order_acquire) == generation)
+        logger = callSite._logger.load(std::memory_order_relaxed);
+    else
+    {
+        logger = GetLoggerByType(filter);
+        callSite._logger.store(logger, std::memory_order_relaxed);
+        callSite._generation.store(generation, std::memory_order_release);
+    }
+
+    if (!logger)
+        return false;
+
+    LogLevel logLevel = logger->GetLevel();
+    return logLevel != LogLevel::Disabled && logLevel >= level;
+}
+
 void Warhead::Log::_OutMessage(std::string_view filter, LogLevel level, std::string_view file, std::size_t line, std::string_view function, std::string_view message)
 {
     Write(std::make_unique<LogMessage>(filter, message, level, file, line, function));
 }
 
+void Warhead::Log::_OutMessage(std::string_view filter, LogLevel level, std::string_view file, std::size_t line, std::string_view function, std::string_view format, LogFormatArgs&& args)
+{
+    auto msg = std::make_unique<LogMessage>(filter, std::string_view{}, level, file, line, function);
+    msg->SetFormatArgs(format, std::move(args));
+    Write(std::move(msg));
+}
+
 void Warhead::Log::_OutCommand(uint32 accountID, std::string_view message)
 {
     Write(std::make_unique<LogMessage>(LOGGER_GM, message, LogLevel::Info, Warhead::ToString(accountID)));
@@ -340,11 +548,57 @@ void Warhead::Log::_OutCommand(uint32 accountID, std::string_view message)
 
 void Warhead::Log::Write(std::unique_ptr<LogMessage>&& msg)
 {
-    if (auto const& logger = GetLoggerByType(msg->GetSource()))
+    // Held until the message is queued, StopAsync waits for it before the queue is drained and freed
+    std::shared_lock<std::shared_mutex> guard(_asyncLock);
+
+    // Fatal messages usually precede an abort, so they must not wait in the queue
+    if (!_async || _async->Stop || msg->GetLevel() == LogLevel::Fatal)
+    {
+        guard.unlock();
+        msg->FormatText();
+        WriteMessage(*msg);
+        return;
+    }
+
+    if (_async->Size >= _async->MaxSize)
+    {
+        if (_async->OverflowPolicy == AsyncOverflowPolicy::Drop)
+        {
+            ++_async->Dropped;
+            return;
+        }
+
+        _async->WriterWakeUp.notify_one();
+
+        std::unique_lock<std::mutex> lock(_async->Lock);
+        _async->SpaceAvailable.wait(lock, [this]()
+        {
+            return _async->Size < _async->MaxSize || _async->Stop;
+        });
+
+        if (_async->Stop)
+        {
+            lock.unlock();
+            guard.unlock();
+            msg->FormatText();
+            WriteMessage(*msg);
+            return;
+        }
+    }
+
+    if (++_async->Size == _async->FlushSize)
+        _async->WriterWakeUp.notify_one();
+
+    _async->Queue.Enqueue(msg.release());
+}
+
+void Warhead::Log::WriteMessage(LogMessage const& msg)
+{
+    if (auto const& logger = GetLoggerByType(msg.GetSource()))
     {
         try
         {
-            logger->Write(*msg);
+            logger->Write(msg);
         }
         catch (const Exception& e)
         {
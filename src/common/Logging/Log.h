@@ -19,7 +19,10 @@
 #define _LOG_H
 
 #include "LogCommon.h"
+#include <atomic>
 #include <fmt/format.h>
+#include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -28,9 +31,31 @@ namespace Warhead
     class Logger;
     class LogChannel;
     class LogMessage;
+    struct AsyncLogQueue;
 
     typedef std::shared_ptr<LogChannel>(*ChannelCreateFn)(std::string_view, LogLevel, std::string_view, std::vector<std::string_view> const&);
 
+    // Arguments copied into a deferred message, anything else is formatted by the caller
+    template<typename T>
+    constexpr bool IsDeferredLogArg = std::is_arithmetic_v<T> || std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+        std::is_same_v<T, char const*> || std::is_same_v<T, char*>;
+
+    /// Logger lookup cached by a LOG_* call site. Logger names given as literals are resolved once
+    /// per logger configuration, other names are still looked up on every call.
+    class LogCallSite
+    {
+        friend class Log;
+
+    public:
+        template<std::size_t N>
+        inline bool ShouldLog(char const (&filter)[N], LogLevel level);
+        inline bool ShouldLog(std::string_view filter, LogLevel level);
+
+    private:
+        std::atomic<Logger*> _logger{ nullptr };
+        std::atomic<uint32> _generation{ 0 };
+    };
+
     template <class ChannelImpl>
     inline std::shared_ptr<LogChannel> CreateChannel(std::string_view name, LogLevel level, std::string_view pattern, std::vector<std::string_view> const& options)
     {
@@ -48,6 +73,13 @@ namespace Warhead
         Log& operator=(Log&&) = delete;
 
     public:
+        struct AsyncStats
+        {
+            uint64 Written{ 0 };
+            uint64 Dropped{ 0 };
+            std::size_t Queued{ 0 };
+        };
+
         static Log* instance();
 
         void Initialize();
@@ -57,9 +89,31 @@ namespace Warhead
         void SetChannelLevel(std::string_view name, LogLevel const level);
         bool ShouldLog(std::string_view filter, LogLevel const level);
 
+        inline bool ShouldLog(LogCallSite& callSite, std::string_view filter, LogLevel const level)
+        {
+            if (level > highestLogLevel)
+                return false;
+
+            return ShouldLogCached(callSite, filter, level);
+        }
+
         template<typename... Args>
         inline void OutMessage(std::string_view filter, LogLevel const level, std::string_view file, std::size_t line, std::string_view function, std::string_view fmt, Args&&... args)
         {
+            // With the async writer, plain arguments are copied and formatted on the writer thread
+            if constexpr (sizeof...(Args) > 0 && (IsDeferredLogArg<std::decay_t<Args>> && ...))
+            {
+                if (IsAsync() && level != LogLevel::Fatal)
+                {
+                    LogFormatArgs formatArgs;
+                    formatArgs.reserve(sizeof...(Args), 0);
+                    (PushFormatArg(formatArgs, std::forward<Args>(args)), ...);
+
+                    _OutMessage(filter, level, file, line, function, fmt, std::move(formatArgs));
+                    return;
+                }
+            }
+
             _OutMessage(filter, level, file, line, function, fmt::format(fmt, std::forward<Args>(args)...));
         }
 
@@ -82,12 +136,40 @@ namespace Warhead
 
         inline std::string_view GetLogsDir() { return _logsDir; }
 
+        // Log.Async.Enable: messages are queued by the calling thread and written by a background thread
+        bool IsAsync() const;
+        AsyncStats GetAsyncStats() const;
+
         void UsingDefaultLogs(bool value = true);
 
     private:
+        template<typename T>
+        static inline void PushFormatArg(LogFormatArgs& formatArgs, T&& arg)
+        {
+            // fmt keeps string views as views, the message outlives them
+            if constexpr (std::is_same_v<std::decay_t<T>, std::string_view>)
+                formatArgs.push_back(std::string{ arg });
+            else if constexpr (std::is_array_v<std::remove_reference_t<T>>)
+                formatArgs.push_back(std::string{ static_cast<char const*>(arg) });
+            else if constexpr (std::is_pointer_v<std::decay_t<T>>)
+                formatArgs.push_back(std::string{ arg ? static_cast<char const*>(arg) : "(null)" });
+            else
+                formatArgs.push_back(std::forward<T>(arg));
+        }
+
+        bool ShouldLogCached(LogCallSite& callSite, std::string_view filter, LogLevel level);
+
         void _OutMessage(std::string_view filter, LogLevel level, std::string_view file, std::size_t line, std::string_view function, std::string_view message);
+        void _OutMessage(std::string_view filter, LogLevel level, std::string_view file, std::size_t line, std::string_view function, std::string_view format, LogFormatArgs&& args);
         void _OutCommand(uint32 accountID, std::string_view message);
         void Write(std::unique_ptr<LogMessage>&& msg);
+        void WriteMessage(LogMessage const& msg);
+
+        void StartAsync();
+        void StopAsync();
+        void AsyncWriterThread(AsyncLogQueue* async);
+        void WriteAsyncQueue(AsyncLogQueue& async);
+        void FlushChannels();
 
         void CreateLoggerFromConfig(std::string_view configLoggerName);
         void CreateChannelsFromConfig(std::string_view logChannelName);
@@ -107,15 +189,30 @@ namespace Warhead
         std::unordered_map<int8, ChannelCreateFn> _channelsCreateFunction;
 
         LogLevel highestLogLevel{ LogLevel::Disabled };
+        std::atomic<uint32> _loggersGeneration{ 1 }; // increased whenever loggers are created or removed, see LogCallSite
         std::string _logsDir;
 
         //
         bool _isUseDefaultLogs{ false };
+
+        std::unique_ptr<AsyncLogQueue> _async;
+        mutable std::shared_mutex _asyncLock; // shared while a message is queued, exclusive to replace _async
     };
 }
 
 #define sLog Warhead::Log::instance()
 
+template<std::size_t N>
+inline bool Warhead::LogCallSite::ShouldLog(char const (&filter)[N], LogLevel level)
+{
+    return sLog->ShouldLog(*this, std::string_view{ filter, N - 1 }, level);
+}
+
+inline bool Warhead::LogCallSite::ShouldLog(std::string_view filter, LogLevel level)
+{
+    return sLog->ShouldLog(filter, level);
+}
+
 #define LOG_EXCEPTION_FREE(filterType__, level__, ...) \
     { \
         try \
@@ -131,37 +228,53 @@ namespace Warhead
 
 #define LOG_MSG_BODY(filterType__, level__, ...)                        \
         do {                                                            \
-            if (sLog->ShouldLog(filterType__, level__))                 \
+            static Warhead::LogCallSite logCallSite__;                  \
+            if (logCallSite__.ShouldLog(filterType__, level__))         \
                 LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
         } while (0)
 
+// Same for a constant level, calls above WARHEAD_LOG_COMPILE_LEVEL are compiled out
+#define LOG_CONST_MSG_BODY(filterType__, level__, ...)                  \
+        do {                                                            \
+            if constexpr (level__ <= Warhead::LOG_COMPILE_LEVEL)        \
+                LOG_MSG_BODY(filterType__, level__, __VA_ARGS__);       \
+        } while (0)
+
+// For code building expensive log output by itself
+#define LOG_IS_ENABLED(filterType__, level__)                           \
+        ((level__ <= Warhead::LOG_COMPILE_LEVEL) && [&]()               \
+        {                                                               \
+            static Warhead::LogCallSite logCallSite__;                  \
+            return logCallSite__.ShouldLog(filterType__, level__);      \
+        }())
+
 // Fatal - 1
 #define LOG_FATAL(filterType__, ...) \
-    LOG_MSG_BODY(filterType__, Warhead::LogLevel::Fatal, __VA_ARGS__)
+    LOG_CONST_MSG_BODY(filterType__, Warhead::LogLevel::Fatal, __VA_ARGS__)
 
 // Critical - 2
 #define LOG_CRIT(filterType__, ...) \
-    LOG_MSG_BODY(filterType__, Warhead::LogLevel::Critical, __VA_ARGS__)
+    LOG_CONST_MSG_BODY(filterType__, Warhead::LogLevel::Critical, __VA_ARGS__)
 
 // Error - 3
 #define LOG_ERROR(filterType__, ...) \
-    LOG_MSG_BODY(filterType__, Warhead::LogLevel::Error, __VA_ARGS__)
+    LOG_CONST_MSG_BODY(filterType__, Warhead::LogLevel::Error, __VA_ARGS__)
 
 // Warning - 4
 #define LOG_WARN(filterType__, ...)  \
-    LOG_MSG_BODY(filterType__, Warhead::LogLevel::Warning, __VA_ARGS__)
+    LOG_CONST_MSG_BODY(filterType__, Warhead::LogLevel::Warning, __VA_ARGS__)
 
 // Info - 5
 #define LOG_INFO(filterType__, ...)  \
-    LOG_MSG_BODY(filterType__, Warhead::LogLevel::Info, __VA_ARGS__)
+    LOG_CONST_MSG_BODY(filterType__, Warhead::LogLevel::Info, __VA_ARGS__)
 
 // Debug - 6
 #define LOG_DEBUG(filterType__, ...) \
-    LOG_MSG_BODY(filterType__, Warhead::LogLevel::Debug, __VA_ARGS__)
+    LOG_CONST_MSG_BODY(filterType__, Warhead::LogLevel::Debug, __VA_ARGS__)
 
 // Trace - 7
 #define LOG_TRACE(filterType__, ...) \
-    LOG_MSG_BODY(filterType__, Warhead::LogLevel::Trace, __VA_ARGS__)
+    LOG_CONST_MSG_BODY(filterType__, Warhead::LogLevel::Trace, __VA_ARGS__)
 
 #define LOG_GM(accountId__, ...) \
     sLog->OutCommand(accountId__, __VA_ARGS__);
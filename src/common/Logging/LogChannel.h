@@ -19,6 +19,7 @@
 #define _WARHEAD_LOG_CHANNEL_H_
 
 #include "LogCommon.h"
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -43,6 +44,13 @@ namespace Warhead
         virtual void Write(LogMessage const& msg) = 0;
         virtual void SetRealmId(uint32 /*realmId*/) { }
 
+        // Buffered channels leave flushing to the async log writer, which calls Flush after every batch
+        inline void SetBuffered(bool buffered) { _isBuffered = buffered; }
+        virtual void Flush() { }
+
+    protected:
+        std::atomic<bool> _isBuffered{ false };
+
     private:
         struct PatternAction
         {
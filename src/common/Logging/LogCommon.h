@@ -19,8 +19,14 @@
 #define _WARHEAD_LOG_COMMON_H_
 
 #include "Define.h"
+#include <fmt/args.h>
 #include <string_view>
 
+// Log calls more verbose than this level are removed at compile time (LOG_COMPILE_LEVEL cmake option)
+#ifndef WARHEAD_LOG_COMPILE_LEVEL
+#define WARHEAD_LOG_COMPILE_LEVEL 7
+#endif
+
 namespace Warhead
 {
     enum class LogLevel : int8
@@ -74,6 +80,11 @@ namespace Warhead
         Max
     };
 
+    constexpr LogLevel LOG_COMPILE_LEVEL = static_cast<LogLevel>(WARHEAD_LOG_COMPILE_LEVEL);
+
+    // Arguments of a message formatted later by the async writer
+    using LogFormatArgs = fmt::dynamic_format_arg_store<fmt::format_context>;
+
     constexpr std::size_t MAX_LOG_LEVEL = static_cast<std::size_t>(LogLevel::Max);
     constexpr std::size_t MAX_CHANNEL_TYPE = static_cast<std::size_t>(ChannelType::Max);
     constexpr std::size_t MAX_CHANNEL_OPTIONS = 7;
@@ -39,3 +39,26 @@ Warhead::LogMessage::LogMessage(std::string_view source, std::string_view text,
     _option(option)
 {
 }
+
+void Warhead::LogMessage::SetFormatArgs(std::string_view format, LogFormatArgs&& args)
+{
+    _format = format;
+    _formatArgs = std::make_unique<LogFormatArgs>(std::move(args));
+}
+
+void Warhead::LogMessage::FormatText()
+{
+    if (!_formatArgs)
+        return;
+
+    try
+    {
+        _text = fmt::vformat(_format, *_formatArgs);
+    }
+    catch (const std::exception& e)
+    {
+        _text = fmt::format("Wrong format occurred ({}) at '{}:{}'", e.what(), _file, _line);
+    }
+
+    _formatArgs.reset();
+}
@@ -20,6 +20,7 @@
 
 #include "Duration.h"
 #include "LogCommon.h"
+#include <memory>
 #include <string>
 
 namespace Warhead
@@ -55,16 +56,25 @@ namespace Warhead
         inline void SetOption(std::string_view option) { _option = option; }
         inline std::string_view GetOption() const { return _option; }
 
+        // Deferred formatting, the text stays empty until FormatText is called
+        void SetFormatArgs(std::string_view format, LogFormatArgs&& args);
+        inline bool HasFormatArgs() const { return _formatArgs != nullptr; }
+        void FormatText();
+
     private:
         std::string _source;
         std::string _text;
         MessageLevel _level{ MessageLevel::Fatal };
         SystemTimePoint _time{ std::chrono::system_clock::now() };
 
-        std::string _file;
+        // Always __FILE__ and __FUNCTION__ of the log call, no need to copy them
+        std::string_view _file;
         std::size_t _line{};
-        std::string _function;
+        std::string_view _function;
         std::string _option;
+
+        std::string _format;
+        std::unique_ptr<LogFormatArgs> _formatArgs;
     };
 }
 
@@ -27,8 +27,185 @@
 #include "Tokenize.h"
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+#include <limits>
+#include <thread>
 #include <utility>
 
+namespace
+{
+    // Upper bounds of the histogram buckets, in microseconds. The last bucket is +Inf
+    constexpr std::array<int64, 10> HistogramBounds = { 1000, 2000, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000 };
+    constexpr std::size_t HistogramBucketCount = HistogramBounds.size() + 1;
+
+    constexpr uint32 SeriesChunkSize = 256;
+    constexpr uint32 MaxSeriesChunks = 64;
+    constexpr uint32 MaxSeries = SeriesChunkSize * MaxSeriesChunks;
+
+    uint64 HashSeries(std::string_view category, MetricTags tags)
+    {
+        // FNV-1a, with a separator so ("ab", "c") and ("a", "bc") differ
+        uint64 hash = 14695981039346656037ULL;
+        auto mix = [&hash](std::string_view str)
+        {
+            for (char c : str)
+                hash = (hash ^ uint8(c)) * 1099511628211ULL;
+
+            hash = (hash ^ 0xFF) * 1099511628211ULL;
+        };
+
+        mix(category);
+        for (MetricTagView const& tag : tags)
+        {
+            mix(tag.first);
+            mix(tag.second);
+        }
+
+        return hash;
+    }
+
+    void AppendInfluxDBEscaped(std::string& out, std::string_view value, std::string_view specialChars)
+    {
+        for (char c : value)
+        {
+            if (specialChars.find(c) != std::string_view::npos)
+                out += '\\';
+
+            out += c;
+        }
+    }
+
+    void AppendPrometheusName(std::string& out, std::string_view name)
+    {
+        for (char c : name)
+            out += std::isalnum(uint8(c)) ? c : '_';
+    }
+
+    void AppendPrometheusLabel(std::string& out, std::string_view name, std::string_view value)
+    {
+        if (!out.empty())
+            out += ',';
+
+        AppendPrometheusName(out, name);
+        out += "=\"";
+
+        for (char c : value)
+        {
+            switch (c)
+            {
+                case '\\': out += "\\\\"; break;
+                case '"': out += "\\\""; break;
+                case '\n': out += "\\n"; break;
+                default: out += c; break;
+            }
+        }
+
+        out += '"';
+    }
+
+    // Batches a retired series id is kept out of use, both thread banks are drained of its samples meanwhile
+    constexpr uint8 RetiredSeriesCoolingBatches = 2;
+
+    thread_local MetricThreadStore* threadStore = nullptr;
+    thread_local std::unordered_map<uint64, std::shared_ptr<MetricSeries const>> threadSeriesCache;
+    thread_local uint32 threadSeriesGeneration = 0;
+}
+
+struct MetricAggregate
+{
+    uint64 Count = 0;
+    int64 Sum = 0;
+    int64 Min = std::numeric_limits<int64>::max();
+    int64 Max = std::numeric_limits<int64>::min();
+    int64 Last = 0;
+    std::array<uint64, HistogramBucketCount> Buckets{};
+
+    void Add(int64 value, MetricSeriesType type)
+    {
+        ++Count;
+        Sum += value;
+        Min = std::min(Min, value);
+        Max = std::max(Max, value);
+        Last = value;
+
+        if (type == METRIC_SERIES_HISTOGRAM)
+            ++Buckets[std::lower_bound(HistogramBounds.begin(), HistogramBounds.end(), value) - HistogramBounds.begin()];
+    }
+
+    void Merge(MetricAggregate const& other)
+    {
+        Count += other.Count;
+        Sum += other.Sum;
+        Min = std::min(Min, other.Min);
+        Max = std::max(Max, other.Max);
+        Last = other.Last;
+
+        for (std::size_t i = 0; i < HistogramBucketCount; ++i)
+            Buckets[i] += other.Buckets[i];
+    }
+};
+
+struct MetricThreadBank
+{
+    std::array<std::unique_ptr<MetricAggregate[]>, MaxSeriesChunks> Chunks;
+
+    MetricAggregate& Get(uint32 id)
+    {
+        std::unique_ptr<MetricAggregate[]>& chunk = Chunks[id / SeriesChunkSize];
+        if (!chunk)
+            chunk = std::make_unique<MetricAggregate[]>(SeriesChunkSize);
+
+        return chunk[id % SeriesChunkSize];
+    }
+};
+
+// Each thread writes into Banks[Epoch] without locking. The encoder flips Epoch and waits for
+// Writing to drop before reading the other bank, so both sides only pay a couple of atomic stores
+struct MetricThreadStore
+{
+    std::atomic<uint8> Epoch{ 0 };
+    std::atomic<bool> Writing{ false };
+    std::array<MetricThreadBank, 2> Banks;
+};
+
+struct MetricSeriesExport
+{
+    // nullptr for an id that is free, cooling down after retirement or registered after the last sync
+    MetricSeries const* Series{ nullptr };
+    uint32 IdleIntervals{ 0 };
+    uint8 CoolingBatches{ 0 };
+
+    std::string InfluxKey;
+    std::string PrometheusName;
+    std::string PrometheusLabels;
+
+    // Samples of the current interval, for InfluxDB
+    MetricAggregate Interval;
+
+    // Cumulative values, for Prometheus
+    MetricAggregate Total;
+};
+
+bool MetricSeries::Matches(std::string_view category, MetricTags tags) const
+{
+    if (Category != category || Tags.size() != tags.size())
+        return false;
+
+    return std::equal(Tags.begin(), Tags.end(), tags.begin(), [](MetricTag const& left, MetricTagView const& right)
+    {
+        return left.first == right.first && left.second == right.second;
+    });
+}
+
+Metric::Metric() = default;
+Metric::~Metric() = default;
+
 Metric* Metric::instance()
 {
     static Metric instance;
@@ -38,7 +215,7 @@ Metric* Metric::instance()
 void Metric::Initialize(std::string const& realmName, std::function<void()> overallStatusLogger)
 {
     _dataStream = std::make_unique<boost::asio::ip::tcp::iostream>();
-    _realmName = FormatInfluxDBTagValue(realmName);
+    _realmName = realmName;
     _batchTimer = std::make_unique<Warhead::Asio::DeadlineTimer>(sIoContextMgr->GetIoContext());
     _overallStatusTimer = std::make_unique<Warhead::Asio::DeadlineTimer>(sIoContextMgr->GetIoContext());
     _overallStatusLogger = std::move(overallStatusLogger);
@@ -53,10 +230,11 @@ bool Metric::Connect()
     auto error = stream.error();
     if (error)
     {
-        LOG_ERROR("metric", "Error connecting to '{}:{}', disabling Metric. Error message: {}",
+        LOG_ERROR("metric", "Error connecting to '{}:{}', disabling InfluxDB sink. Error message: {}",
             _hostname, _port, error.message());
 
-        _enabled = false;
+        _influxEnabled = false;
+        _enabled = !_prometheusFile.empty();
         return false;
     }
 
@@ -76,6 +254,8 @@ void Metric::LoadFromConfigs()
         _updateInterval = 1;
     }
 
+    _seriesExpireIntervals = sConfigMgr->GetOption<uint32>("Metric.SeriesExpireIntervals", 60);
+
     _overallStatusTimerInterval = sConfigMgr->GetOption<int32>("Metric.OverallStatusInterval", 1);
     if (_overallStatusTimerInterval < 1)
     {
@@ -96,24 +276,33 @@ void Metric::LoadFromConfigs()
     // Cancel any scheduled operation if the config changed from Enabled to Disabled.
     if (_enabled && !previousValue)
     {
+        _prometheusFile = sConfigMgr->GetOption<std::string>("Metric.Prometheus.TextFile", "");
+        _influxEnabled = false;
+
         auto connectionInfo = sConfigMgr->GetOption<std::string>("Metric.ConnectionInfo", "");
-        if (connectionInfo.empty())
+        if (!connectionInfo.empty())
         {
-            LOG_ERROR("metric", "'Metric.ConnectionInfo' not specified in configuration file.");
-            return;
+            std::vector<std::string_view> tokens = Warhead::Tokenize(connectionInfo, ';', true);
+            if (tokens.size() == 3)
+            {
+                _hostname.assign(tokens[0]);
+                _port.assign(tokens[1]);
+                _databaseName.assign(tokens[2]);
+                _influxEnabled = true;
+            }
+            else
+                LOG_ERROR("metric", "'Metric.ConnectionInfo' specified with wrong format in configuration file.");
         }
 
-        std::vector<std::string_view> tokens = Warhead::Tokenize(connectionInfo, ';', true);
-        if (tokens.size() != 3)
+        if (!_influxEnabled && _prometheusFile.empty())
         {
-            LOG_ERROR("metric", "'Metric.ConnectionInfo' specified with wrong format in configuration file.");
+            LOG_ERROR("metric", "Neither 'Metric.ConnectionInfo' nor 'Metric.Prometheus.TextFile' specified in configuration file, disabling Metric.");
+            _enabled = false;
             return;
         }
 
-        _hostname.assign(tokens[0]);
-        _port.assign(tokens[1]);
-        _databaseName.assign(tokens[2]);
-        Connect();
+        if (_influxEnabled)
+            Connect();
 
         ScheduleSend();
         ScheduleOverallStatusLog();
@@ -129,7 +318,7 @@ void Metric::Update()
     }
 }
 
-bool Metric::ShouldLog(std::string const& category, int64 value) const
+bool Metric::ShouldLog(std::string_view category, int64 value) const
 {
     auto threshold = _thresholds.find(category);
 
@@ -141,6 +330,119 @@ bool Metric::ShouldLog(std::string const& category, int64 value) const
     return value >= threshold->second;
 }
 
+std::shared_ptr<MetricSeries const> Metric::RegisterSeries(std::string_view category, MetricTags tags, MetricSeriesType type)
+{
+    uint64 hash = HashSeries(category, tags);
+
+    std::lock_guard<std::mutex> guard(_seriesLock);
+
+    auto bounds = _seriesByHash.equal_range(hash);
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+        if (itr->second->Matches(category, tags))
+            return _seriesById[itr->second->Id];
+
+    uint32 id;
+    if (!_freeSeriesIds.empty())
+    {
+        id = _freeSeriesIds.back();
+        _freeSeriesIds.pop_back();
+    }
+    else if (_seriesById.size() < MaxSeries)
+    {
+        id = uint32(_seriesById.size());
+        _seriesById.emplace_back();
+    }
+    else
+    {
+        if (!_seriesLimitReported)
+        {
+            LOG_ERROR("metric", "Metric series limit ({}) reached, dropping samples of new series (first dropped: '{}').", MaxSeries, category);
+            _seriesLimitReported = true;
+        }
+
+        return nullptr;
+    }
+
+    std::shared_ptr<MetricSeries> series = std::make_shared<MetricSeries>();
+    series->Id = id;
+    series->Type = type;
+    series->Hash = hash;
+    series->Category.assign(category);
+    series->Tags.reserve(tags.size());
+
+    for (MetricTagView const& tag : tags)
+        series->Tags.emplace_back(std::string(tag.first), std::string(tag.second));
+
+    _seriesById[id] = series;
+    _seriesByHash.emplace(hash, series.get());
+    _newSeriesIds.push_back(id);
+    return series;
+}
+
+MetricSeries const* Metric::GetSeries(std::string_view category, MetricTags tags, MetricSeriesType type)
+{
+    // Retired series are dropped before their ids can be reused, the cache keeps them alive until then
+    uint32 generation = _seriesGeneration.load(std::memory_order_acquire);
+    if (threadSeriesGeneration != generation)
+    {
+        std::erase_if(threadSeriesCache, [](auto const& entry) { return entry.second->Retired.load(std::memory_order_relaxed); });
+        threadSeriesGeneration = generation;
+    }
+
+    uint64 hash = HashSeries(category, tags);
+
+    auto itr = threadSeriesCache.find(hash);
+    if (itr != threadSeriesCache.end() && itr->second->Matches(category, tags))
+        return itr->second.get();
+
+    std::shared_ptr<MetricSeries const> series = RegisterSeries(category, tags, type);
+    if (!series)
+        return nullptr;
+
+    MetricSeries const* result = series.get();
+    threadSeriesCache[hash] = std::move(series);
+    return result;
+}
+
+MetricThreadStore& Metric::GetThreadStore()
+{
+    if (!threadStore)
+    {
+        std::lock_guard<std::mutex> guard(_threadStoresLock);
+        threadStore = _threadStores.emplace_back(std::make_unique<MetricThreadStore>()).get();
+    }
+
+    return *threadStore;
+}
+
+void Metric::Record(MetricSeries const* series, int64 value)
+{
+    if (!series)
+        return;
+
+    MetricThreadStore& store = GetThreadStore();
+
+    // Must be seq_cst on both sides, pairs with the Epoch flip / Writing check in CollectThreadStores
+    store.Writing.store(true);
+    store.Banks[store.Epoch.load()].Get(series->Id).Add(value, series->Type);
+    store.Writing.store(false, std::memory_order_release);
+}
+
+void Metric::LogRawValue(std::string_view category, std::string value, MetricTags tags)
+{
+    MetricData* data = new MetricData;
+    data->Category.assign(category);
+    data->Timestamp = std::chrono::system_clock::now();
+    data->Type = METRIC_DATA_VALUE;
+    data->Value = std::move(value);
+    data->Tags.reserve(tags.size());
+
+    for (MetricTagView const& tag : tags)
+        data->Tags.emplace_back(std::string(tag.first), std::string(tag.second));
+
+    _queuedData.Enqueue(data);
+}
+
 void Metric::LogEvent(std::string const& category, std::string const& title, std::string const& description)
 {
     using namespace std::chrono;
@@ -155,62 +457,268 @@ void Metric::LogEvent(std::string const& category, std::string const& title, std
     _queuedData.Enqueue(data);
 }
 
-void Metric::SendBatch()
+void Metric::CollectThreadStores()
 {
-    using namespace std::chrono;
+    {
+        std::lock_guard<std::mutex> guard(_seriesLock);
 
-    std::stringstream batchedData;
-    MetricData* data;
-    bool firstLoop = true;
+        for (uint32 id : _newSeriesIds)
+        {
+            if (id >= _exports.size())
+                _exports.resize(id + 1);
+
+            MetricSeriesExport& exported = _exports[id];
+            exported = MetricSeriesExport();
+            exported.Series = _seriesById[id].get();
+            MetricSeries const& series = *exported.Series;
+
+            // Tag sets are encoded once per series instead of once per sample
+            AppendInfluxDBEscaped(exported.InfluxKey, series.Category, ", ");
+            if (!_realmName.empty())
+            {
+                exported.InfluxKey += ",realm=";
+                AppendInfluxDBEscaped(exported.InfluxKey, _realmName, ", =");
+                AppendPrometheusLabel(exported.PrometheusLabels, "realm", _realmName);
+            }
+
+            for (MetricTag const& tag : series.Tags)
+            {
+                exported.InfluxKey += ',';
+                AppendInfluxDBEscaped(exported.InfluxKey, tag.first, ", =");
+                exported.InfluxKey += '=';
+                AppendInfluxDBEscaped(exported.InfluxKey, tag.second, ", =");
+                AppendPrometheusLabel(exported.PrometheusLabels, tag.first, tag.second);
+            }
+
+            exported.PrometheusName = "warhead_";
+            AppendPrometheusName(exported.PrometheusName, series.Category);
+            if (series.Type == METRIC_SERIES_HISTOGRAM)
+                exported.PrometheusName += "_ms";
+
+            _prometheusOrder.push_back(id);
+        }
+
+        if (!_newSeriesIds.empty())
+        {
+            _newSeriesIds.clear();
+
+            // Prometheus requires the samples of one metric family to be contiguous
+            std::stable_sort(_prometheusOrder.begin(), _prometheusOrder.end(), [this](uint32 left, uint32 right)
+            {
+                return _exports[left].PrometheusName < _exports[right].PrometheusName;
+            });
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(_threadStoresLock);
 
+    for (std::unique_ptr<MetricThreadStore> const& store : _threadStores)
+    {
+        uint8 epoch = store->Epoch.load(std::memory_order_relaxed);
+        store->Epoch.store(epoch ^ 1);
+
+        // A writer that read the old epoch is still inside Record
+        while (store->Writing.load())
+            std::this_thread::yield();
+
+        MetricThreadBank& bank = store->Banks[epoch];
+        for (uint32 chunkIndex = 0; chunkIndex < MaxSeriesChunks; ++chunkIndex)
+        {
+            if (!bank.Chunks[chunkIndex])
+                continue;
+
+            MetricAggregate* chunk = bank.Chunks[chunkIndex].get();
+            for (uint32 i = 0; i < SeriesChunkSize; ++i)
+            {
+                uint32 id = chunkIndex * SeriesChunkSize + i;
+                if (!chunk[i].Count)
+                    continue;
+
+                MetricSeriesExport* exported = id < _exports.size() ? &_exports[id] : nullptr;
+                if (!exported || !exported->Series)
+                {
+                    // Late samples of a retired series are dropped, series registered after the
+                    // export list was synced above stay in the bank until the next batch
+                    if (exported && exported->CoolingBatches)
+                        chunk[i] = MetricAggregate();
+
+                    continue;
+                }
+
+                exported->Interval.Merge(chunk[i]);
+                chunk[i] = MetricAggregate();
+            }
+        }
+    }
+}
+
+void Metric::CloseInterval()
+{
+    _expiredSeriesIds.clear();
+    _freedSeriesIds.clear();
+
+    for (uint32 id = 0; id < _exports.size(); ++id)
+    {
+        MetricSeriesExport& exported = _exports[id];
+        if (!exported.Series)
+        {
+            if (exported.CoolingBatches && !--exported.CoolingBatches)
+                _freedSeriesIds.push_back(id);
+
+            continue;
+        }
+
+        MetricAggregate& interval = exported.Interval;
+        if (interval.Count)
+        {
+            exported.Total.Merge(interval);
+            interval = MetricAggregate();
+            exported.IdleIntervals = 0;
+        }
+        else if (_seriesExpireIntervals && ++exported.IdleIntervals >= _seriesExpireIntervals)
+            _expiredSeriesIds.push_back(id);
+    }
+
+    if (_expiredSeriesIds.empty() && _freedSeriesIds.empty())
+        return;
+
+    std::lock_guard<std::mutex> guard(_seriesLock);
+
+    _freeSeriesIds.insert(_freeSeriesIds.end(), _freedSeriesIds.begin(), _freedSeriesIds.end());
+
+    if (_expiredSeriesIds.empty())
+        return;
+
+    for (uint32 id : _expiredSeriesIds)
+    {
+        std::shared_ptr<MetricSeries>& series = _seriesById[id];
+        series->Retired.store(true, std::memory_order_relaxed);
+
+        auto bounds = _seriesByHash.equal_range(series->Hash);
+        for (auto itr = bounds.first; itr != bounds.second; ++itr)
+        {
+            if (itr->second == series.get())
+            {
+                _seriesByHash.erase(itr);
+                break;
+            }
+        }
+
+        series.reset();
+
+        _exports[id] = MetricSeriesExport();
+        _exports[id].CoolingBatches = RetiredSeriesCoolingBatches;
+    }
+
+    std::erase_if(_prometheusOrder, [this](uint32 id) { return !_exports[id].Series; });
+
+    _seriesLimitReported = false;
+    _seriesGeneration.fetch_add(1, std::memory_order_release);
+}
+
+void Metric::DiscardQueuedData()
+{
+    MetricData* data;
     while (_queuedData.Dequeue(data))
+        delete data;
+}
+
+void Metric::DiscardPendingData()
+{
+    DiscardQueuedData();
+    CollectThreadStores();
+
+    for (MetricSeriesExport& exported : _exports)
+        exported.Interval = MetricAggregate();
+}
+
+void Metric::EncodeInfluxDB(SystemTimePoint now)
+{
+    using namespace std::chrono;
+
+    auto appendTimestamp = [this](SystemTimePoint timestamp)
     {
-        if (!firstLoop)
-            batchedData << "\n";
+        fmt::format_to(std::back_inserter(_influxBuffer), " {}\n", duration_cast<nanoseconds>(timestamp.time_since_epoch()).count());
+    };
 
-        batchedData << data->Category;
+    MetricData* data;
+    while (_queuedData.Dequeue(data))
+    {
+        AppendInfluxDBEscaped(_influxBuffer, data->Category, ", ");
         if (!_realmName.empty())
-            batchedData << ",realm=" << _realmName;
+        {
+            _influxBuffer += ",realm=";
+            AppendInfluxDBEscaped(_influxBuffer, _realmName, ", =");
+        }
 
         for (MetricTag const& tag : data->Tags)
-            batchedData << "," << tag.first << "=" << FormatInfluxDBTagValue(tag.second);
-
-        batchedData << " ";
+        {
+            _influxBuffer += ',';
+            AppendInfluxDBEscaped(_influxBuffer, tag.first, ", =");
+            _influxBuffer += '=';
+            AppendInfluxDBEscaped(_influxBuffer, tag.second, ", =");
+        }
 
         switch (data->Type)
         {
             case METRIC_DATA_VALUE:
-                batchedData << "value=" << data->Value;
+                _influxBuffer += " value=";
+                _influxBuffer += data->Value;
                 break;
             case METRIC_DATA_EVENT:
-                batchedData << "title=\"" << data->Title << "\",text=\"" << data->Text << "\"";
+                _influxBuffer += " title=\"";
+                AppendInfluxDBEscaped(_influxBuffer, data->Title, "\"\\");
+                _influxBuffer += "\",text=\"";
+                AppendInfluxDBEscaped(_influxBuffer, data->Text, "\"\\");
+                _influxBuffer += '"';
                 break;
         }
 
-        batchedData << " " << std::to_string(duration_cast<nanoseconds>(data->Timestamp.time_since_epoch()).count());
-
-        firstLoop = false;
+        appendTimestamp(data->Timestamp);
         delete data;
     }
 
-    // Check if there's any data to send
-    if (batchedData.tellp() == std::streampos(0))
+    // One point per series and interval. 'value' keeps its integer type: last sample for gauges, mean milliseconds
+    // for timers. Queries over single samples use the other fields: sum("sum") for totals, max("max") for peaks
+    for (MetricSeriesExport const& exported : _exports)
     {
-        ScheduleSend();
-        return;
+        MetricAggregate const& interval = exported.Interval;
+        if (!exported.Series || !interval.Count)
+            continue;
+
+        _influxBuffer += exported.InfluxKey;
+
+        if (exported.Series->Type == METRIC_SERIES_HISTOGRAM)
+            fmt::format_to(std::back_inserter(_influxBuffer), " value={}i,count={}i,sum={:.3f},min={:.3f},max={:.3f}",
+                interval.Sum / int64(interval.Count) / 1000, interval.Count, interval.Sum / 1000.0, interval.Min / 1000.0, interval.Max / 1000.0);
+        else
+            fmt::format_to(std::back_inserter(_influxBuffer), " value={}i,count={}i,sum={}i,min={}i,max={}i",
+                interval.Last, interval.Count, interval.Sum, interval.Min, interval.Max);
+
+        appendTimestamp(now);
     }
+}
+
+void Metric::SendInfluxDB()
+{
+    // Check if there's any data to send
+    if (_influxBuffer.empty())
+        return;
 
     if (!GetDataStream().good() && !Connect())
         return;
 
-    GetDataStream() << "POST " << "/write?db=" << _databaseName << " HTTP/1.1\r\n";
-    GetDataStream() << "Host: " << _hostname << ":" << _port << "\r\n";
-    GetDataStream() << "Accept: */*\r\n";
-    GetDataStream() << "Content-Type: application/octet-stream\r\n";
-    GetDataStream() << "Content-Transfer-Encoding: binary\r\n";
+    _requestBuffer.clear();
+    fmt::format_to(std::back_inserter(_requestBuffer),
+        "POST /write?db={} HTTP/1.1\r\n"
+        "Host: {}:{}\r\n"
+        "Accept: */*\r\n"
+        "Content-Type: application/octet-stream\r\n"
+        "Content-Transfer-Encoding: binary\r\n"
+        "Content-Length: {}\r\n\r\n", _databaseName, _hostname, _port, _influxBuffer.size());
 
-    GetDataStream() << "Content-Length: " << std::to_string(batchedData.tellp()) << "\r\n\r\n";
-    GetDataStream() << batchedData.rdbuf();
+    GetDataStream().write(_requestBuffer.data(), _requestBuffer.size());
+    GetDataStream().write(_influxBuffer.data(), _influxBuffer.size());
 
     std::string http_version;
     GetDataStream() >> http_version;
@@ -236,6 +744,102 @@ void Metric::SendBatch()
             dynamic_cast<boost::asio::ip::tcp::iostream&>(GetDataStream()).close();
         }
     }
+}
+
+void Metric::WritePrometheus()
+{
+    _prometheusBuffer.clear();
+
+    std::string_view family;
+    for (uint32 id : _prometheusOrder)
+    {
+        MetricSeriesExport const& exported = _exports[id];
+        MetricAggregate const& total = exported.Total;
+        if (!exported.Series || !total.Count)
+            continue;
+
+        bool histogram = exported.Series->Type == METRIC_SERIES_HISTOGRAM;
+        if (family != exported.PrometheusName)
+        {
+            family = exported.PrometheusName;
+            fmt::format_to(std::back_inserter(_prometheusBuffer), "# TYPE {} {}\n", family, histogram ? "histogram" : "gauge");
+        }
+
+        std::string_view labels = exported.PrometheusLabels;
+        std::string_view separator = labels.empty() ? "" : ",";
+
+        if (!histogram)
+        {
+            if (labels.empty())
+                fmt::format_to(std::back_inserter(_prometheusBuffer), "{} {}\n", family, total.Last);
+            else
+                fmt::format_to(std::back_inserter(_prometheusBuffer), "{}{{{}}} {}\n", family, labels, total.Last);
+
+            continue;
+        }
+
+        uint64 cumulative = 0;
+        for (std::size_t i = 0; i < HistogramBucketCount; ++i)
+        {
+            cumulative += total.Buckets[i];
+
+            if (i < HistogramBounds.size())
+                fmt::format_to(std::back_inserter(_prometheusBuffer), "{}_bucket{{{}{}le=\"{}\"}} {}\n", family, labels, separator, HistogramBounds[i] / 1000, cumulative);
+            else
+                fmt::format_to(std::back_inserter(_prometheusBuffer), "{}_bucket{{{}{}le=\"+Inf\"}} {}\n", family, labels, separator, cumulative);
+        }
+
+        fmt::format_to(std::back_inserter(_prometheusBuffer), "{}_sum{{{}}} {:.3f}\n", family, labels, total.Sum / 1000.0);
+        fmt::format_to(std::back_inserter(_prometheusBuffer), "{}_count{{{}}} {}\n", family, labels, total.Count);
+    }
+
+    // Write next to the target and rename so a scraper never reads a partial file
+    std::string tempFile = _prometheusFile + ".tmp";
+    {
+        std::ofstream file(tempFile, std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!file)
+        {
+            LOG_ERROR("metric", "Error opening '{}' for writing Prometheus metrics.", tempFile);
+            return;
+        }
+
+        file.write(_prometheusBuffer.data(), _prometheusBuffer.size());
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempFile, _prometheusFile, error);
+    if (error)
+        LOG_ERROR("metric", "Error renaming '{}' to '{}'. Error message: {}", tempFile, _prometheusFile, error.message());
+}
+
+std::string_view Metric::EncodeBatch(SystemTimePoint now)
+{
+    _influxBuffer.clear();
+
+    CollectThreadStores();
+    EncodeInfluxDB(now);
+    CloseInterval();
+
+    return _influxBuffer;
+}
+
+void Metric::SendBatch()
+{
+    if (_influxEnabled)
+    {
+        EncodeBatch(std::chrono::system_clock::now());
+        SendInfluxDB();
+    }
+    else
+    {
+        // events and non integral values only go to InfluxDB
+        DiscardQueuedData();
+        CollectThreadStores();
+        CloseInterval();
+    }
+
+    if (!_prometheusFile.empty())
+        WritePrometheus();
 
     ScheduleSend();
 }
@@ -250,13 +854,7 @@ void Metric::ScheduleSend()
     else
     {
         dynamic_cast<boost::asio::ip::tcp::iostream&>(GetDataStream()).close();
-        MetricData* data;
-
-        // Clear the queue
-        while (_queuedData.Dequeue(data))
-        {
-            delete data;
-        }
+        DiscardPendingData();
     }
 }
 
@@ -317,17 +915,6 @@ std::string Metric::FormatInfluxDBValue(float value)
     return FormatInfluxDBValue(double(value));
 }
 
-std::string Metric::FormatInfluxDBTagValue(std::string const& value)
-{
-    // ToDo: should handle '=' and ',' characters too
-    return boost::replace_all_copy(value, " ", "\\ ");
-}
-
-std::string Metric::FormatInfluxDBValue(std::chrono::nanoseconds value)
-{
-    return FormatInfluxDBValue(std::chrono::duration_cast<Milliseconds>(value).count());
-}
-
 template WH_COMMON_API std::string Metric::FormatInfluxDBValue(int8);
 template WH_COMMON_API std::string Metric::FormatInfluxDBValue(uint8);
 template WH_COMMON_API std::string Metric::FormatInfluxDBValue(int16);
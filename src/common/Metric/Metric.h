@@ -22,9 +22,16 @@
 #include "Define.h"
 #include "Duration.h"
 #include "MPSCQueue.h"
+#include <atomic>
 #include <functional>
+#include <initializer_list>
 #include <iosfwd>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -35,7 +42,15 @@ enum MetricDataType
     METRIC_DATA_EVENT
 };
 
+enum MetricSeriesType : uint8
+{
+    METRIC_SERIES_GAUGE,        // last reported value wins, integral values
+    METRIC_SERIES_HISTOGRAM     // durations, aggregated in microseconds
+};
+
 typedef std::pair<std::string, std::string> MetricTag;
+typedef std::pair<std::string_view, std::string_view> MetricTagView;
+typedef std::initializer_list<MetricTagView> MetricTags;
 
 struct MetricData
 {
@@ -52,6 +67,29 @@ struct MetricData
     std::string Text;
 };
 
+// Interned category + tag set, not changed after registration. A series without samples for
+// Metric.SeriesExpireIntervals batches is retired and its id reused, thread caches drop it lazily
+struct WH_COMMON_API MetricSeries
+{
+    uint32 Id{ 0 };
+    MetricSeriesType Type{ METRIC_SERIES_GAUGE };
+    uint64 Hash{ 0 };
+    std::string Category;
+    std::vector<MetricTag> Tags;
+    std::atomic<bool> Retired{ false };
+
+    bool Matches(std::string_view category, MetricTags tags) const;
+};
+
+template<class T>
+struct IsMetricDuration : std::false_type { };
+
+template<class Rep, class Period>
+struct IsMetricDuration<std::chrono::duration<Rep, Period>> : std::true_type { };
+
+struct MetricThreadStore;
+struct MetricSeriesExport;
+
 class WH_COMMON_API Metric
 {
 private:
@@ -63,19 +101,57 @@ private:
     int32 _updateInterval = 0;
     int32 _overallStatusTimerInterval = 0;
     bool _enabled = false;
+    bool _influxEnabled = false;
     bool _overallStatusTimerTriggered = false;
     std::string _hostname;
     std::string _port;
     std::string _databaseName;
+    std::string _prometheusFile;
+    uint32 _seriesExpireIntervals = 60;
     std::function<void()> _overallStatusLogger;
     std::string _realmName;
-    std::unordered_map<std::string, int64> _thresholds;
+    std::map<std::string, int64, std::less<>> _thresholds;
+
+    // Series registry, written by any thread on first use of a category + tag set
+    std::mutex _seriesLock;
+    std::vector<std::shared_ptr<MetricSeries>> _seriesById;
+    std::unordered_multimap<uint64, MetricSeries const*> _seriesByHash;
+    std::vector<uint32> _newSeriesIds;
+    std::vector<uint32> _freeSeriesIds;
+    bool _seriesLimitReported = false;
+
+    // Bumped whenever series are retired, tells the thread caches to drop them
+    std::atomic<uint32> _seriesGeneration{ 0 };
+
+    // Per thread aggregation stores, owned here so they outlive the threads that filled them
+    std::mutex _threadStoresLock;
+    std::vector<std::unique_ptr<MetricThreadStore>> _threadStores;
+
+    // Encoder state, only touched by SendBatch
+    std::vector<MetricSeriesExport> _exports;
+    std::vector<uint32> _prometheusOrder;
+    std::vector<uint32> _expiredSeriesIds;
+    std::vector<uint32> _freedSeriesIds;
+    std::string _influxBuffer;
+    std::string _requestBuffer;
+    std::string _prometheusBuffer;
 
     bool Connect();
     void SendBatch();
     void ScheduleSend();
     void ScheduleOverallStatusLog();
 
+    std::shared_ptr<MetricSeries const> RegisterSeries(std::string_view category, MetricTags tags, MetricSeriesType type);
+    MetricThreadStore& GetThreadStore();
+    void CollectThreadStores();
+    void CloseInterval();
+    void DiscardQueuedData();
+    void DiscardPendingData();
+    void EncodeInfluxDB(SystemTimePoint now);
+    void SendInfluxDB();
+    void WritePrometheus();
+    void LogRawValue(std::string_view category, std::string value, MetricTags tags);
+
     static std::string FormatInfluxDBValue(bool value);
 
     template <class T>
@@ -85,40 +161,41 @@ private:
     static std::string FormatInfluxDBValue(char const* value);
     static std::string FormatInfluxDBValue(double value);
     static std::string FormatInfluxDBValue(float value);
-    static std::string FormatInfluxDBValue(std::chrono::nanoseconds value);
-
-    static std::string FormatInfluxDBTagValue(std::string const& value);
-
-    // ToDo: should format TagKey and FieldKey too in the same way as TagValue
 
 public:
-    Metric() = default;
-    ~Metric()= default;
+    Metric();
+    ~Metric();
 
     static Metric* instance();
 
     void Initialize(std::string const& realmName, std::function<void()> overallStatusLogger);
     void LoadFromConfigs();
     void Update();
-    bool ShouldLog(std::string const& category, int64 value) const;
+    bool ShouldLog(std::string_view category, int64 value) const;
 
-    template<class T>
-    void LogValue(std::string const& category, T value, std::vector<MetricTag> tags)
-    {
-        using namespace std::chrono;
+    // Series of a category + tag set, nullptr once the series limit is reached. Only valid until the series
+    // expires, look it up again instead of keeping it
+    MetricSeries const* GetSeries(std::string_view category, MetricTags tags, MetricSeriesType type);
 
-        MetricData* data = new MetricData;
-        data->Category = category;
-        data->Timestamp = system_clock::now();
-        data->Type = METRIC_DATA_VALUE;
-        data->Value = FormatInfluxDBValue(value);
-        data->Tags = std::move(tags);
+    // Aggregates a sample into the calling thread's store. Histogram values are in microseconds
+    void Record(MetricSeries const* series, int64 value);
 
-        _queuedData.Enqueue(data);
+    template<class T>
+    void LogValue(std::string_view category, T value, MetricTags tags)
+    {
+        if constexpr (IsMetricDuration<T>::value)
+            Record(GetSeries(category, tags, METRIC_SERIES_HISTOGRAM), int64(std::chrono::duration_cast<Microseconds>(value).count()));
+        else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+            Record(GetSeries(category, tags, METRIC_SERIES_GAUGE), int64(value));
+        else
+            LogRawValue(category, FormatInfluxDBValue(value), tags);
     }
 
     void LogEvent(std::string const& category, std::string const& title, std::string const& description);
 
+    // Collects the samples of all threads and encodes them as InfluxDB line protocol, as sent by the batch timer
+    std::string_view EncodeBatch(SystemTimePoint now);
+
     void Unload();
     bool IsEnabled() const { return _enabled; }
 };
@@ -204,8 +281,8 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
 #define METRIC_DETAILED_TIMER(category, ...)                                                                  \
         MetricStopWatch METRIC_UNIQUE_NAME(__ac_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start) \
         {                                                                                                        \
-            int64 duration = int64(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - start).count()); \
-            if (sMetric->ShouldLog(category, duration))                                                          \
+            auto duration = std::chrono::steady_clock::now() - start;                                            \
+            if (sMetric->ShouldLog(category, std::chrono::duration_cast<Milliseconds>(duration).count()))        \
                 sMetric->LogValue(category, duration, { __VA_ARGS__ });                                          \
         });
 #define METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...) METRIC_TIMER(category, __VA_ARGS__)
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WARHEAD_ALIAS_TABLE_H
+#define WARHEAD_ALIAS_TABLE_H
+
+#include "Define.h"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace Warhead
+{
+    /**
+     * Walker/Vose alias table. Picks one of N weighted outcomes with a single
+     * uniform random number in O(1), after an O(N) build. Weights don't need
+     * to be normalized, outcomes with weight 0 are never picked.
+     */
+    class AliasTable
+    {
+    public:
+        AliasTable() = default;
+
+        template<typename Container>
+        explicit AliasTable(Container const& weights) { Build(weights); }
+
+        template<typename Container>
+        void Build(Container const& weights)
+        {
+            _probability.clear();
+            _alias.clear();
+
+            double total = 0.0;
+            for (auto weight : weights)
+                total += std::max(double(weight), 0.0);
+
+            if (total <= 0.0)
+                return;
+
+            std::size_t const count = std::size(weights);
+            _probability.resize(count);
+            _alias.resize(count);
+
+            std::vector<double> scaled;
+            scaled.reserve(count);
+            for (auto weight : weights)
+                scaled.push_back(std::max(double(weight), 0.0) * count / total);
+
+            std::vector<uint32> small, large;
+            for (uint32 i = 0; i < count; ++i)
+                (scaled[i] < 1.0 ? small : large).push_back(i);
+
+            while (!small.empty() && !large.empty())
+            {
+                uint32 less = small.back();
+                small.pop_back();
+                uint32 more = large.back();
+
+                _probability[less] = scaled[less];
+                _alias[less] = more;
+
+                scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+                if (scaled[more] < 1.0)
+                {
+                    large.pop_back();
+                    small.push_back(more);
+                }
+            }
+
+            // leftovers are 1.0 up to rounding errors, a zero weight can not be left over
+            for (uint32 i : large)
+            {
+                _probability[i] = 1.0;
+                _alias[i] = i;
+            }
+
+            for (uint32 i : small)
+            {
+                _probability[i] = 1.0;
+                _alias[i] = i;
+            }
+        }
+
+        [[nodiscard]] bool empty() const { return _probability.empty(); }
+        [[nodiscard]] std::size_t size() const { return _probability.size(); }
+
+        // uniform must be in [0, 1), see rand_norm()
+        [[nodiscard]] std::size_t Sample(double uniform) const
+        {
+            double scaled = uniform * _probability.size();
+            std::size_t column = std::min(std::size_t(scaled), _probability.size() - 1);
+            return (scaled - double(column)) < _probability[column] ? column : _alias[column];
+        }
+
+    private:
+        std::vector<double> _probability;
+        std::vector<uint32> _alias;
+    };
+}
+
+#endif //! #ifdef WARHEAD_ALIAS_TABLE_H
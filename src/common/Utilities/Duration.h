@@ -20,6 +20,9 @@
 
 #include <chrono>
 
+/// Nanoseconds shorthand typedef.
+using Nanoseconds = std::chrono::nanoseconds;
+
 /// Microseconds shorthand typedef.
 using Microseconds = std::chrono::microseconds;
 
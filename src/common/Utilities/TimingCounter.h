@@ -0,0 +1,75 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WARHEAD_TIMING_COUNTER_H
+#define WARHEAD_TIMING_COUNTER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <atomic>
+
+namespace Warhead
+{
+    struct TimingStats
+    {
+        uint64 Calls{ 0 };
+        Nanoseconds Total{ 0 };
+        Nanoseconds Max{ 0 };
+    };
+
+    /**
+     * Call count, total and max time of one measured piece of code. Lock-free,
+     * so any thread may add to it while another one reads or resets it.
+     */
+    class TimingCounter
+    {
+    public:
+        void Add(Nanoseconds elapsed)
+        {
+            uint64 ns = uint64(elapsed.count());
+
+            _calls.fetch_add(1, std::memory_order_relaxed);
+            _totalNs.fetch_add(ns, std::memory_order_relaxed);
+
+            uint64 max = _maxNs.load(std::memory_order_relaxed);
+            while (ns > max && !_maxNs.compare_exchange_weak(max, ns, std::memory_order_relaxed)) { }
+        }
+
+        void Reset()
+        {
+            _calls.store(0, std::memory_order_relaxed);
+            _totalNs.store(0, std::memory_order_relaxed);
+            _maxNs.store(0, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] TimingStats Get() const
+        {
+            TimingStats stats;
+            stats.Calls = _calls.load(std::memory_order_relaxed);
+            stats.Total = Nanoseconds(_totalNs.load(std::memory_order_relaxed));
+            stats.Max = Nanoseconds(_maxNs.load(std::memory_order_relaxed));
+            return stats;
+        }
+
+    private:
+        std::atomic<uint64> _calls{ 0 };
+        std::atomic<uint64> _totalNs{ 0 };
+        std::atomic<uint64> _maxNs{ 0 };
+    };
+}
+
+#endif
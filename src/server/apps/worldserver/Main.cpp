@@ -490,6 +490,18 @@ void ClearOnlineAccounts()
     // pussywizard: tc query would set online=0 even if logged in on another realm >_>
     AuthDatabase.DirectExecute("UPDATE account SET online = 0 WHERE online = {}", realm.Id.Realm);
 
+    // Characters still marked online were in game when the realm went down, give their accounts login priority
+    if (QueryResult result = CharacterDatabase.Query("SELECT DISTINCT account FROM characters WHERE online <> 0"))
+    {
+        std::unordered_set<uint32> accounts;
+
+        for (auto const& fields : *result)
+            accounts.emplace(fields[0].Get<uint32>());
+
+        LOG_INFO("server.loading", ">> {} accounts were online before the restart and get login priority", accounts.size());
+        sWorld->SetPriorityLoginAccounts(std::move(accounts));
+    }
+
     // Reset online status for all characters
     CharacterDatabase.DirectExecute("UPDATE characters SET online = 0 WHERE online <> 0");
 }
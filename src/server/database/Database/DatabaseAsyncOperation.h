@@ -63,6 +63,9 @@ public:
     void ExecuteQuery() override;
     [[nodiscard]] PreparedQueryResultFuture GetFuture() const { return _result->get_future(); }
 
+    [[nodiscard]] PreparedStatement const& GetStatement() const { return _stmt; }
+    [[nodiscard]] bool HasResult() const { return _hasResult; }
+
 private:
     PreparedStatement _stmt;
     std::unique_ptr<PreparedQueryResultPromise> _result;
@@ -32,6 +32,14 @@ enum class ConnectionFlags : uint8
     Both    = Async | Sync
 };
 
+//! Declares how executions of the same statement queued back to back may be merged into one round trip
+enum class StatementCoalescing : uint8
+{
+    None,           // always sent on its own
+    MultiRow,       // INSERT/REPLACE ... VALUES (...), merged into one statement with a row per execution
+    MultiStatement  // sent together as one multi-statement query
+};
+
 enum class DatabaseType : uint8
 {
     None,
@@ -23,6 +23,7 @@
 #include "Errors.h"
 #include "FileUtil.h"
 #include "Log.h"
+#include "Metric.h"
 #include "MySQLConnection.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
@@ -69,7 +70,8 @@ public:
 };
 
 DatabaseWorkerPool::DatabaseWorkerPool(DatabaseType type) :
-    _poolType(type)
+    _poolType(type),
+    _stats(std::make_unique<MySQLConnectionStats>())
 {
     ASSERT(mysql_thread_safe(), "Used MySQL library isn't thread-safe");
 
@@ -206,7 +208,7 @@ QueryResult DatabaseWorkerPool::Query(std::string_view sql)
 
 std::pair<uint32, MySQLConnection*> DatabaseWorkerPool::OpenConnection(InternalIndex type, bool isDynamic /*= false*/)
 {
-    auto connection = std::make_unique<MySQLConnection>(*_connectionInfo, type == IDX_ASYNC, isDynamic);
+    auto connection = std::make_unique<MySQLConnection>(*_connectionInfo, type == IDX_ASYNC, isDynamic, _stats.get());
     if (uint32 error = connection->Open())
     {
         // Failed to open a connection or invalid version
@@ -311,7 +313,7 @@ bool DatabaseWorkerPool::PrepareStatements()
     for (auto const& [index, stmt] : _stringPreparedStatement)
         for (auto const& connections : _connections)
             for (auto const& connection : connections)
-                connection->PrepareStatement(index, stmt.Query, stmt.ConnectionType);
+                connection->PrepareStatement(index, stmt.Query, stmt.ConnectionType, stmt.Coalescing);
 
     auto IsValidPrepareStatements = [this](MySQLConnection* connection)
     {
@@ -372,7 +374,7 @@ PreparedStatement DatabaseWorkerPool::GetPreparedStatement(uint32 index)
     return std::make_shared<PreparedStatementBase>(index, _preparedStatementSize[index]);
 }
 
-void DatabaseWorkerPool::PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags)
+void DatabaseWorkerPool::PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags, StatementCoalescing coalescing /*= StatementCoalescing::None*/)
 {
     auto const& itr = _stringPreparedStatement.find(index);
     if (itr != _stringPreparedStatement.end())
@@ -381,7 +383,16 @@ void DatabaseWorkerPool::PrepareStatement(uint32 index, std::string_view sql, Co
         return;
     }
 
-    _stringPreparedStatement.emplace(index, StringPreparedStatement{ index, sql, flags });
+    _stringPreparedStatement.emplace(index, StringPreparedStatement{ index, sql, flags, coalescing });
+}
+
+bool DatabaseWorkerPool::IsStatementPreparedFor(uint32 index, ConnectionFlags flags) const
+{
+    auto const& itr = _stringPreparedStatement.find(index);
+    if (itr == _stringPreparedStatement.end())
+        return false;
+
+    return ((uint8)itr->second.ConnectionType & (uint8)flags) == (uint8)flags;
 }
 
 PreparedQueryResult DatabaseWorkerPool::Query(PreparedStatement stmt)
@@ -595,7 +606,7 @@ unsigned long DatabaseWorkerPool::EscapeString(char* to, char const* from, unsig
 
 SQLQueryHolderCallback DatabaseWorkerPool::DelayQueryHolder(SQLQueryHolder holder)
 {
-    auto task = new SQLQueryHolderTask(holder);
+    auto task = new SQLQueryHolderTask(holder, _batchQueryHolders && holder->IsBatched());
     QueryResultHolderFuture result = task->GetFuture();
     Enqueue(task);
     return { std::move(holder), std::move(result) };
@@ -623,6 +634,9 @@ void DatabaseWorkerPool::AddTasks()
         ASSERT(_maxQueueSize > 0, "Can not be equal to 0");
     }
 
+    if (_poolType == DatabaseType::Character)
+        _batchQueryHolders = sConfigMgr->GetOption<bool>("Database.BatchQueryHolders", true);
+
     // DB ping
     _scheduler->Schedule(Minutes{ sConfigMgr->GetOption<uint32>("MaxPingTime", 30) }, [this](TaskContext context)
     {
@@ -637,6 +651,27 @@ void DatabaseWorkerPool::AddTasks()
         CleanupConnections();
         context.Repeat();
     });
+
+    // Statements and round trips per second
+    _scheduler->Schedule(10s, [this](TaskContext context)
+    {
+        UpdateStatistics(10s);
+        context.Repeat();
+    });
+}
+
+void DatabaseWorkerPool::UpdateStatistics(Seconds interval)
+{
+    uint64 statements = _stats->Statements;
+    uint64 roundTrips = _stats->RoundTrips;
+
+    _statementsPerSecond = (statements - _lastStatements) / interval.count();
+    _roundTripsPerSecond = (roundTrips - _lastRoundTrips) / interval.count();
+    _lastStatements = statements;
+    _lastRoundTrips = roundTrips;
+
+    METRIC_VALUE("db_statements_per_second", _statementsPerSecond, METRIC_TAG("pool", _poolName));
+    METRIC_VALUE("db_round_trips_per_second", _roundTripsPerSecond, METRIC_TAG("pool", _poolName));
 }
 
 void DatabaseWorkerPool::OpenDynamicAsyncConnect()
@@ -683,6 +718,8 @@ void DatabaseWorkerPool::GetPoolInfo(std::function<void(std::string_view)> const
     auto allSize{ GetQueueSize() };
     for (auto const& connection : _connections[IDX_ASYNC])
         info(Warhead::StringFormat("Index: {}. Size: {}/{}", ++queueIndex, connection->GetQueueSize(), allSize));
+
+    info(Warhead::StringFormat("Statements per second: {}. Round trips per second: {}", _statementsPerSecond, _roundTripsPerSecond));
 }
 
 void DatabaseWorkerPool::InitDynamicConnections()
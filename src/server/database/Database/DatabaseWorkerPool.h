@@ -35,14 +35,17 @@ class AsyncOperation;
 class AsyncEnqueue;
 class TaskScheduler;
 
+struct MySQLConnectionStats;
+
 struct StringPreparedStatement
 {
-    StringPreparedStatement(uint32 index, std::string_view sql, ConnectionFlags flags) :
-        Index(index), Query(sql), ConnectionType(flags) { }
+    StringPreparedStatement(uint32 index, std::string_view sql, ConnectionFlags flags, StatementCoalescing coalescing) :
+        Index(index), Query(sql), ConnectionType(flags), Coalescing(coalescing) { }
 
     uint32 Index{};
     std::string Query;
     ConnectionFlags ConnectionType{ ConnectionFlags::Sync };
+    StatementCoalescing Coalescing{ StatementCoalescing::None };
 };
 
 class WH_DATABASE_API DatabaseWorkerPool
@@ -195,7 +198,12 @@ public:
     //! This object is not tied to the prepared statement on the MySQL context yet until execution.
     PreparedStatement GetPreparedStatement(uint32 index);
 
-    void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags);
+    //! Executions of statements declared with coalescing that are queued back to back (in the async queue or in a transaction)
+    //! are sent to the server in one round trip. Only declare it where merging cannot change the outcome.
+    void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags, StatementCoalescing coalescing = StatementCoalescing::None);
+
+    //! True if the statement gets prepared on every connection type in flags, false for unknown statements.
+    [[nodiscard]] bool IsStatementPreparedFor(uint32 index, ConnectionFlags flags) const;
 
     // Close dynamic connections if need
     void CleanupConnections();
@@ -242,6 +250,7 @@ private:
 
     unsigned long EscapeString(char* to, char const* from, unsigned long length);
     void AddTasks();
+    void UpdateStatistics(Seconds interval);
     void MakeExtraFile();
     void ExecuteAsyncQueue();
 
@@ -265,6 +274,14 @@ private:
     std::unique_ptr<TaskScheduler> _scheduler{};
     bool _isEnableDynamicConnections{};
     uint32 _maxQueueSize{ 50 };
+    bool _batchQueryHolders{ true };
+
+    // Statements and round trips of all connections, rates are updated by UpdateStatistics
+    std::unique_ptr<MySQLConnectionStats> _stats;
+    uint64 _lastStatements{};
+    uint64 _lastRoundTrips{};
+    uint64 _statementsPerSecond{};
+    uint64 _roundTripsPerSecond{};
 
     // Dynamic async enqueue
     std::unique_ptr<ProducerConsumerQueue<AsyncEnqueue*>> _queue;
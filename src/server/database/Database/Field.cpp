@@ -292,6 +292,99 @@ template WH_DATABASE_API int64 Field::GetData() const;
 template WH_DATABASE_API float Field::GetData() const;
 template WH_DATABASE_API double Field::GetData() const;
 
+namespace
+{
+    template<typename T, typename Signed, typename Unsigned>
+    inline T ReadRawInteger(char const* value)
+    {
+        // Read with the signedness the caller asked for, prepared statements bind integers with their column width
+        using Integer = std::conditional_t<std::is_signed_v<T>, Signed, Unsigned>;
+
+        Integer result;
+        memcpy(&result, value, sizeof(Integer));
+        return static_cast<T>(result);
+    }
+
+    template<typename T>
+    inline T ReadRawValue(DatabaseFieldTypes type, char const* value)
+    {
+        switch (type)
+        {
+            case DatabaseFieldTypes::Int8:
+                return ReadRawInteger<T, int8, uint8>(value);
+            case DatabaseFieldTypes::Int16:
+                return ReadRawInteger<T, int16, uint16>(value);
+            case DatabaseFieldTypes::Int32:
+                return ReadRawInteger<T, int32, uint32>(value);
+            case DatabaseFieldTypes::Int64:
+                return ReadRawInteger<T, int64, uint64>(value);
+            case DatabaseFieldTypes::Float:
+            {
+                float result;
+                memcpy(&result, value, sizeof(float));
+                return static_cast<T>(result);
+            }
+            case DatabaseFieldTypes::Double:
+            {
+                double result;
+                memcpy(&result, value, sizeof(double));
+                return static_cast<T>(result);
+            }
+            default:
+                return GetDefaultValue<T>();
+        }
+    }
+}
+
+template<typename T>
+T Field::GetUnchecked() const
+{
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        if (!data.value)
+            return GetDefaultValue<T>();
+
+        // Decimals are sent as strings by both protocols
+        if (data.raw && meta->Type != DatabaseFieldTypes::Decimal)
+            return ReadRawValue<T>(meta->Type, data.value);
+
+        std::string_view value{ data.value, data.length };
+
+        if (Optional<T> result = Warhead::StringTo<T>(value))
+            return *result;
+
+        // Negative values in unsigned columns of the *_dbc tables
+        if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool>)
+            if (Optional<std::make_signed_t<T>> result = Warhead::StringTo<std::make_signed_t<T>>(value))
+                return static_cast<T>(*result);
+
+        return GetDefaultValue<T>();
+    }
+    else if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>)
+    {
+        if (!data.value)
+            return {};
+
+        return T{ data.value, data.length };
+    }
+    else
+        static_assert(Warhead::dependant_false_v<T>, "Unsupported type for Field::GetUnchecked()");
+}
+
+template WH_DATABASE_API bool Field::GetUnchecked() const;
+template WH_DATABASE_API uint8 Field::GetUnchecked() const;
+template WH_DATABASE_API uint16 Field::GetUnchecked() const;
+template WH_DATABASE_API uint32 Field::GetUnchecked() const;
+template WH_DATABASE_API uint64 Field::GetUnchecked() const;
+template WH_DATABASE_API int8 Field::GetUnchecked() const;
+template WH_DATABASE_API int16 Field::GetUnchecked() const;
+template WH_DATABASE_API int32 Field::GetUnchecked() const;
+template WH_DATABASE_API int64 Field::GetUnchecked() const;
+template WH_DATABASE_API float Field::GetUnchecked() const;
+template WH_DATABASE_API double Field::GetUnchecked() const;
+template WH_DATABASE_API std::string_view Field::GetUnchecked() const;
+template WH_DATABASE_API std::string Field::GetUnchecked() const;
+
 std::string Field::GetDataString() const
 {
     if (!data.value)
@@ -73,6 +73,10 @@ struct QueryResultFieldMetadata
     | BLOB, LONGBLOB         | Get<Binary>, Get<std::string>           |
     | BINARY, VARBINARY      | Get<Binary>                             |
 
+    Bulk loaders reading a known schema can use GetUnchecked<T> (or the
+    typed row helpers of the result sets) instead: the value is read with
+    the column's native width and no per value diagnostics are done.
+
     Return types of aggregate functions:
 
     | Function |       Type        |
@@ -128,6 +132,12 @@ public:
         return convertToUin32 ? T(GetData<uint32>()) : T(GetData<uint64>());
     }
 
+    //! Reads the value without the type diagnostics and alias fix ups of Get<T>.
+    //! NULL or unconvertible values are returned as the same defaults Get<T> uses.
+    //! Supports arithmetic types, std::string_view (points into the result buffer) and std::string.
+    template<typename T>
+    [[nodiscard]] T GetUnchecked() const;
+
     [[nodiscard]] inline bool IsNull() const
     {
         return data.value == nullptr;
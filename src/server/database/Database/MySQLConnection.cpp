@@ -28,6 +28,7 @@
 #include "StringConvert.h"
 #include "Tokenize.h"
 #include "Transaction.h"
+#include "Util.h"
 #include <errmsg.h>
 #include <mysql.h>
 #include <mysqld_error.h>
@@ -37,6 +38,7 @@ namespace
 {
     constexpr auto DB_DEFAULT_CHARSET = "utf8mb4";
     constexpr auto DYNAMIC_CONNECTION_TIMEOUT = 1s;
+    constexpr std::size_t MAX_COALESCED_STATEMENTS = 100;
 
     std::string GetConnectionFlagString(ConnectionFlags flag)
     {
@@ -67,10 +69,11 @@ MySQLConnectionInfo::MySQLConnectionInfo(std::string_view infoString)
         SSL.assign(tokens.at(5));
 }
 
-MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo, bool isAsync/* = false*/, bool isDynamic /*= false*/) :
+MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo, bool isAsync/* = false*/, bool isDynamic /*= false*/, MySQLConnectionStats* stats /*= nullptr*/) :
     _connectionInfo(connInfo),
     _isDynamic(isDynamic),
     _connectionFlags(isAsync ? ConnectionFlags::Async : ConnectionFlags::Sync),
+    _stats(stats),
     _queue(std::make_unique<ProducerConsumerQueue<AsyncOperation*>>())
 {
     if (!_isDynamic)
@@ -152,6 +155,7 @@ uint32 MySQLConnection::Open()
         // set connection properties to UTF8 to properly handle locales for different
         // server configs - core sends data in UTF8, so MySQL must expect UTF8 too
         mysql_set_character_set(_mysqlHandle, DB_DEFAULT_CHARSET);
+        _multiStatements = false;
         return 0;
     }
     else
@@ -187,6 +191,7 @@ bool MySQLConnection::Execute(std::string_view sql)
             LOG_DEBUG("db.query", "[{}] Query: {}", sw, sql);
     }
 
+    CountRoundTrip();
     UpdateLastUseTime();
     return true;
 }
@@ -237,6 +242,7 @@ bool MySQLConnection::Execute(PreparedStatement stmt)
     LOG_DEBUG("db.query", "[{}] Query(p): {}", sw, mStmt->getQueryString());
 
     mStmt->ClearParameters();
+    CountRoundTrip();
     UpdateLastUseTime();
     return true;
 }
@@ -275,6 +281,77 @@ PreparedQueryResult MySQLConnection::Query(PreparedStatement stmt)
     return std::make_shared<PreparedResultSet>(mysqlStmt->GetSTMT(), result, rowCount, fieldCount);
 }
 
+bool MySQLConnection::QueryBatch(std::vector<PreparedStatement> const& stmts, std::vector<PreparedQueryResult>& results)
+{
+    if (!_mysqlHandle || stmts.empty() || !EnableMultiStatements())
+        return false;
+
+    bool result = QueryMultiStatements(stmts, results);
+    DisableMultiStatements();
+    return result;
+}
+
+bool MySQLConnection::QueryMultiStatements(std::vector<PreparedStatement> const& stmts, std::vector<PreparedQueryResult>& results)
+{
+    std::string sql;
+
+    for (auto const& stmt : stmts)
+    {
+        std::string query = GetBatchQueryString(stmt);
+        if (query.empty())
+            return false;
+
+        sql.append(query).append(";");
+    }
+
+    StopWatch sw;
+
+    if (mysql_real_query(_mysqlHandle, sql.data(), sql.size()))
+    {
+        uint32 err = mysql_errno(_mysqlHandle);
+        LOG_ERROR("db.query", "[{}] {}", err, mysql_error(_mysqlHandle));
+        LOG_ERROR("db.query", "Query(b): {}", sql);
+
+        // Reconnect if needed, the caller retries statement by statement
+        HandleMySQLError(err);
+        return false;
+    }
+
+    std::vector<PreparedQueryResult> batchResults(stmts.size());
+
+    for (std::size_t i = 0; i < stmts.size(); ++i)
+    {
+        if (auto result = reinterpret_cast<MySQLResult*>(mysql_store_result(_mysqlHandle)))
+            batchResults[i] = std::make_shared<PreparedResultSet>(result, mysql_num_rows(result), mysql_num_fields(result));
+        else if (mysql_field_count(_mysqlHandle))
+        {
+            LOG_ERROR("db.query", "[{}] {}", mysql_errno(_mysqlHandle), mysql_error(_mysqlHandle));
+            LOG_ERROR("db.query", "Query(b): {}", sql);
+            DiscardPendingResults();
+            return false;
+        }
+
+        // 0 - more results, -1 - no more results, > 0 - error in the next statement
+        int status = mysql_next_result(_mysqlHandle);
+        if (status > 0 || (status < 0 && i + 1 < stmts.size()))
+        {
+            LOG_ERROR("db.query", "[{}] {}", mysql_errno(_mysqlHandle), mysql_error(_mysqlHandle));
+            LOG_ERROR("db.query", "Query(b): {}", sql);
+            DiscardPendingResults();
+            return false;
+        }
+    }
+
+    DiscardPendingResults();
+
+    LOG_DEBUG("db.query", "[{}] Query(b): {} statements", sw, stmts.size());
+
+    CountRoundTrip(stmts.size());
+    results = std::move(batchResults);
+    UpdateLastUseTime();
+    return true;
+}
+
 bool MySQLConnection::Query(std::string_view sql, MySQLResult** result, MySQLField** fields, uint64* rowCount, uint32* fieldCount)
 {
     if (!_mysqlHandle || sql.empty())
@@ -297,6 +374,7 @@ bool MySQLConnection::Query(std::string_view sql, MySQLResult** result, MySQLFie
         else
             LOG_DEBUG("db.query", "[{}] Query: {}", sw, sql);
 
+        CountRoundTrip();
         *result = reinterpret_cast<MySQLResult*>(mysql_store_result(_mysqlHandle));
         *rowCount = mysql_affected_rows(_mysqlHandle);
         *fieldCount = mysql_field_count(_mysqlHandle);
@@ -362,6 +440,7 @@ bool MySQLConnection::Query(PreparedStatement stmt, MySQLPreparedStatement** mys
     LOG_DEBUG("db.query", "[{}] Query(p): {}", sw, mStmt->getQueryString());
 
     mStmt->ClearParameters();
+    CountRoundTrip();
 
     *result = reinterpret_cast<MySQLResult*>(mysql_stmt_result_metadata(msql_STMT));
     *rowCount = mysql_stmt_num_rows(msql_STMT);
@@ -369,6 +448,88 @@ bool MySQLConnection::Query(PreparedStatement stmt, MySQLPreparedStatement** mys
     return true;
 }
 
+bool MySQLConnection::EnableMultiStatements()
+{
+    if (_multiStatements)
+        return true;
+
+    if (mysql_set_server_option(_mysqlHandle, MYSQL_OPTION_MULTI_STATEMENTS_ON))
+    {
+        LOG_ERROR("db.connection", "[{}] Could not enable multi statements: {}", mysql_errno(_mysqlHandle), mysql_error(_mysqlHandle));
+        return false;
+    }
+
+    _multiStatements = true;
+    return true;
+}
+
+void MySQLConnection::DisableMultiStatements()
+{
+    // A reconnect already dropped the option together with the old handle
+    if (!_multiStatements || !_mysqlHandle)
+        return;
+
+    if (mysql_set_server_option(_mysqlHandle, MYSQL_OPTION_MULTI_STATEMENTS_OFF))
+        LOG_ERROR("db.connection", "[{}] Could not disable multi statements: {}", mysql_errno(_mysqlHandle), mysql_error(_mysqlHandle));
+
+    _multiStatements = false;
+}
+
+std::string MySQLConnection::GetBatchQueryString(PreparedStatement const& stmt)
+{
+    MySQLPreparedStatement* mStmt = GetPreparedStatement(stmt->GetIndex());
+    if (!mStmt)
+        return {};
+
+    return BindQueryString(mStmt->_queryString, stmt->GetParameters());
+}
+
+std::string MySQLConnection::BindQueryString(std::string_view query, std::vector<PreparedStatementData> const& params)
+{
+    auto escape = [this](char const* data, std::size_t length)
+    {
+        std::string escaped(length * 2 + 1, '\0');
+        escaped.resize(EscapeString(escaped.data(), data, length));
+        return escaped;
+    };
+
+    std::string queryString(query);
+    std::size_t pos{};
+
+    for (PreparedStatementData const& data : params)
+    {
+        pos = queryString.find('?', pos);
+        if (pos == std::string::npos)
+            return {};
+
+        std::string replaceStr = std::visit([&](auto&& value) -> std::string
+        {
+            using T = std::decay_t<decltype(value)>;
+
+            if constexpr (std::is_same_v<T, std::string>)
+                return Warhead::StringFormat("'{}'", escape(value.data(), value.size()));
+            else if constexpr (std::is_same_v<T, std::vector<uint8>>)
+                return Warhead::StringFormat("X'{}'", ByteArrayToHexStr(value));
+            else if constexpr (std::is_same_v<T, bool>)
+                return value ? "1" : "0";
+            else
+                return PreparedStatementData::ToString(value);
+        }, data.data);
+
+        queryString.replace(pos, 1, replaceStr);
+        pos += replaceStr.length();
+    }
+
+    return queryString;
+}
+
+void MySQLConnection::DiscardPendingResults()
+{
+    while (mysql_more_results(_mysqlHandle) && !mysql_next_result(_mysqlHandle))
+        if (MYSQL_RES* result = mysql_store_result(_mysqlHandle))
+            mysql_free_result(result);
+}
+
 /*static*/ std::string_view MySQLConnection::GetClientInfo()
 {
     return { mysql_get_client_info() };
@@ -474,7 +635,7 @@ MySQLPreparedStatement* MySQLConnection::GetPreparedStatement(uint32 index)
     return ret;
 }
 
-void MySQLConnection::PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags)
+void MySQLConnection::PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags, StatementCoalescing coalescing /*= StatementCoalescing::None*/)
 {
     // Check if specified query should be prepared on this connection
     // i.e. don't prepare async statements on synchronous connections
@@ -502,7 +663,11 @@ void MySQLConnection::PrepareStatement(uint32 index, std::string_view sql, Conne
             _prepareError = true;
         }
         else
-            _stmtList.emplace(index, std::make_unique<MySQLPreparedStatement>(reinterpret_cast<MySQLStmt*>(stmt), sql));
+        {
+            auto mStmt = std::make_unique<MySQLPreparedStatement>(reinterpret_cast<MySQLStmt*>(stmt), sql);
+            mStmt->SetCoalescing(coalescing);
+            _stmtList.emplace(index, std::move(mStmt));
+        }
     }
 }
 
@@ -529,8 +694,10 @@ int32 MySQLConnection::ExecuteTransaction(SQLTransaction transaction)
 
     BeginTransaction();
 
-    for (auto const& data : *queries)
+    for (std::size_t i = 0; i < queries->size(); ++i)
     {
+        auto const& data = (*queries)[i];
+
         switch (data.type)
         {
             case SQL_ELEMENT_PREPARED:
@@ -549,12 +716,43 @@ int32 MySQLConnection::ExecuteTransaction(SQLTransaction transaction)
 
                 ASSERT(stmt);
 
-                if (!Execute(stmt))
+                // Executions of the same coalescable statement appended back to back are sent in one round trip
+                std::vector<PreparedStatement> stmts{ stmt };
+                MySQLPreparedStatement* mStmt = GetPreparedStatement(stmt->GetIndex());
+
+                while (mStmt && mStmt->GetCoalescing() != StatementCoalescing::None && stmts.size() < MAX_COALESCED_STATEMENTS && i + 1 < queries->size())
+                {
+                    auto nextStmt = std::get_if<PreparedStatement>(&(*queries)[i + 1].element);
+                    if (!nextStmt || !*nextStmt || (*nextStmt)->GetIndex() != stmt->GetIndex())
+                        break;
+
+                    stmts.emplace_back(*nextStmt);
+                    ++i;
+                }
+
+                // No one by one fallback here: a deadlock or a lost connection already ended the transaction
+                // on the server, the remaining statements would run in autocommit. The error goes to the
+                // rollback and the deadlock retry of the caller instead.
+                uint32 mergeError = 0;
+                std::size_t executed = stmts.size() > 1 ? ExecuteMerged(stmts, mergeError) : 0;
+
+                if (mergeError)
                 {
                     LOG_WARN("db.query", "Transaction aborted. {} queries not executed.", queries->size());
-                    int32 errorCode = GetLastError();
                     RollbackTransaction();
-                    return errorCode;
+                    return mergeError;
+                }
+
+                // Nothing was sent if the merge was not possible, so the statements can still run one by one
+                for (; executed < stmts.size(); ++executed)
+                {
+                    if (!Execute(stmts[executed]))
+                    {
+                        LOG_WARN("db.query", "Transaction aborted. {} queries not executed.", queries->size());
+                        int32 errorCode = GetLastError();
+                        RollbackTransaction();
+                        return errorCode;
+                    }
                 }
             }
             break;
@@ -634,21 +832,148 @@ void MySQLConnection::ExecuteQueue()
     if (!_queue)
         return;
 
+    AsyncOperation* next = nullptr;
+
     for (;;)
     {
-        AsyncOperation* task = nullptr;
+        AsyncOperation* task = std::exchange(next, nullptr);
 
-        _queue->WaitAndPop(task);
+        if (!task)
+            _queue->WaitAndPop(task);
 
         if (!task)
             break;
 
         task->SetConnection(this);
+
+        if (PreparedStatementTask* stmtTask = GetCoalescableTask(task))
+        {
+            next = ExecuteCoalescedTasks(stmtTask);
+            continue;
+        }
+
         task->ExecuteQuery();
         delete task;
     }
 }
 
+PreparedStatementTask* MySQLConnection::GetCoalescableTask(AsyncOperation* task)
+{
+    auto stmtTask = dynamic_cast<PreparedStatementTask*>(task);
+    if (!stmtTask || stmtTask->HasResult())
+        return nullptr;
+
+    MySQLPreparedStatement* mStmt = GetPreparedStatement(stmtTask->GetStatement()->GetIndex());
+    return mStmt && mStmt->GetCoalescing() != StatementCoalescing::None ? stmtTask : nullptr;
+}
+
+AsyncOperation* MySQLConnection::ExecuteCoalescedTasks(PreparedStatementTask* first)
+{
+    uint32 index = first->GetStatement()->GetIndex();
+
+    std::vector<std::unique_ptr<PreparedStatementTask>> tasks;
+    std::vector<PreparedStatement> stmts;
+    tasks.emplace_back(first);
+    stmts.emplace_back(first->GetStatement());
+
+    // Take everything queued behind it for the same statement, the first other task is returned to run next
+    AsyncOperation* next = nullptr;
+
+    while (stmts.size() < MAX_COALESCED_STATEMENTS && _queue->Pop(next))
+    {
+        PreparedStatementTask* stmtTask = GetCoalescableTask(next);
+        if (!stmtTask || stmtTask->GetStatement()->GetIndex() != index)
+            break;
+
+        tasks.emplace_back(stmtTask);
+        stmts.emplace_back(stmtTask->GetStatement());
+        next = nullptr;
+    }
+
+    // Whatever could not be sent merged (an error or a lost connection) is executed one by one,
+    // so each statement still succeeds or fails exactly as if it was never coalesced
+    uint32 mergeError = 0;
+    std::size_t executed = stmts.size() > 1 ? ExecuteMerged(stmts, mergeError) : 0;
+
+    for (; executed < stmts.size(); ++executed)
+        Execute(stmts[executed]);
+
+    return next;
+}
+
+std::size_t MySQLConnection::ExecuteMerged(std::vector<PreparedStatement> const& stmts, uint32& error)
+{
+    MySQLPreparedStatement* mStmt = GetPreparedStatement(stmts.front()->GetIndex());
+    if (!_mysqlHandle || !mStmt)
+        return 0;
+
+    bool multiRow = mStmt->GetCoalescing() == StatementCoalescing::MultiRow;
+    if (!multiRow && !EnableMultiStatements())
+        return 0;
+
+    std::string_view query{ mStmt->_queryString };
+    std::string sql;
+
+    if (multiRow)
+    {
+        std::string_view row = query.substr(mStmt->_rowBegin, mStmt->_rowEnd - mStmt->_rowBegin);
+        sql.append(query.substr(0, mStmt->_rowBegin));
+
+        for (std::size_t i = 0; i < stmts.size(); ++i)
+            sql.append(i ? ", " : "").append(BindQueryString(row, stmts[i]->GetParameters()));
+
+        sql.append(query.substr(mStmt->_rowEnd));
+    }
+    else
+    {
+        for (auto const& stmt : stmts)
+            sql.append(BindQueryString(query, stmt->GetParameters())).append(";");
+    }
+
+    StopWatch sw;
+
+    if (mysql_real_query(_mysqlHandle, sql.data(), sql.size()))
+    {
+        error = mysql_errno(_mysqlHandle);
+        LOG_ERROR("db.query", "[{}] {}", error, mysql_error(_mysqlHandle));
+        LOG_ERROR("db.query", "Query(c): {}", sql);
+
+        // Reconnect if needed
+        HandleMySQLError(error);
+        DisableMultiStatements();
+        return 0;
+    }
+
+    // A multi-statement query stops at the first failing statement, everything before it was executed
+    std::size_t executed = multiRow ? stmts.size() : 1;
+
+    for (; executed < stmts.size(); ++executed)
+    {
+        if (MYSQL_RES* result = mysql_store_result(_mysqlHandle))
+            mysql_free_result(result);
+
+        if (mysql_next_result(_mysqlHandle))
+        {
+            error = mysql_errno(_mysqlHandle);
+            LOG_ERROR("db.query", "[{}] {}", error, mysql_error(_mysqlHandle));
+            LOG_ERROR("db.query", "Query(c): {}", sql);
+            break;
+        }
+    }
+
+    if (MYSQL_RES* result = mysql_store_result(_mysqlHandle))
+        mysql_free_result(result);
+
+    DiscardPendingResults();
+    DisableMultiStatements();
+
+    LOG_DEBUG("db.query", "[{}] Query(c): {} statements", sw, executed);
+
+    CountRoundTrip(executed);
+    UpdateLastUseTime();
+    return executed;
+}
+
 void MySQLConnection::Enqueue(AsyncOperation* operation) const
 {
     _queue->Push(operation);
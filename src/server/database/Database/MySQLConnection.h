@@ -20,16 +20,20 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Duration.h"
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <string_view>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 template <typename T>
 class ProducerConsumerQueue;
 
 class AsyncOperation;
+class PreparedStatementTask;
+struct PreparedStatementData;
 
 using PreparedStatementList = std::unordered_map<uint32, std::unique_ptr<MySQLPreparedStatement>>;
 
@@ -45,10 +49,17 @@ struct WH_DATABASE_API MySQLConnectionInfo
     std::string SSL;
 };
 
+//! Counters shared by all connections of a pool
+struct MySQLConnectionStats
+{
+    std::atomic<uint64> Statements{};
+    std::atomic<uint64> RoundTrips{};
+};
+
 class WH_DATABASE_API MySQLConnection
 {
 public:
-    explicit MySQLConnection(MySQLConnectionInfo& connInfo, bool isAsync = false, bool isDynamic = false);
+    explicit MySQLConnection(MySQLConnectionInfo& connInfo, bool isAsync = false, bool isDynamic = false, MySQLConnectionStats* stats = nullptr);
     virtual ~MySQLConnection();
 
     virtual uint32 Open();
@@ -62,8 +73,12 @@ public:
     QueryResult Query(std::string_view sql);
     PreparedQueryResult Query(PreparedStatement stmt);
 
+    //! Sends all statements to the server in a single multi-statement round trip, results are stored in the same order.
+    //! Returns false if the batch could not be executed, in which case no result was stored and the caller should fall back to Query.
+    bool QueryBatch(std::vector<PreparedStatement> const& stmts, std::vector<PreparedQueryResult>& results);
+
     MySQLPreparedStatement* GetPreparedStatement(uint32 index);
-    void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags);
+    void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags, StatementCoalescing coalescing = StatementCoalescing::None);
 
     inline PreparedStatementList* GetPreparedStatementList() { return &_stmtList; }
 
@@ -99,6 +114,29 @@ private:
     bool Query(std::string_view sql, MySQLResult** result, MySQLField** fields, uint64* rowCount, uint32* fieldCount);
     bool Query(PreparedStatement stmt, MySQLPreparedStatement** mysqlStmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount);
     bool HandleMySQLError(uint32 errNo, uint8 attempts = 5);
+    // Multi statements are only switched on around a merged send, so no other query
+    // on the connection accepts ';' chained SQL
+    bool EnableMultiStatements();
+    void DisableMultiStatements();
+    bool QueryMultiStatements(std::vector<PreparedStatement> const& stmts, std::vector<PreparedQueryResult>& results);
+    std::string GetBatchQueryString(PreparedStatement const& stmt);
+    std::string BindQueryString(std::string_view query, std::vector<PreparedStatementData> const& params);
+    void DiscardPendingResults();
+
+    // Coalescing of StatementCoalescing statements
+    PreparedStatementTask* GetCoalescableTask(AsyncOperation* task);
+    AsyncOperation* ExecuteCoalescedTasks(PreparedStatementTask* first);
+    // Returns how many statements were executed, error is set when the merged send failed on the server
+    std::size_t ExecuteMerged(std::vector<PreparedStatement> const& stmts, uint32& error);
+
+    inline void CountRoundTrip(std::size_t statements = 1)
+    {
+        if (!_stats)
+            return;
+
+        _stats->Statements += statements;
+        ++_stats->RoundTrips;
+    }
     inline void UpdateLastUseTime() { _lastUseTime = std::chrono::system_clock::now(); }
     void ExecuteQueue();
 
@@ -109,7 +147,9 @@ private:
     std::mutex _mutex;
     bool _isDynamic{};
     bool _prepareError{};  //! Was there any error while preparing statements?
+    bool _multiStatements{}; //! Multi-statement support is currently enabled, only during a merged send
     SystemTimePoint _lastUseTime;
+    MySQLConnectionStats* _stats;
 
     // Async
     std::unique_ptr<ProducerConsumerQueue<AsyncOperation*>> _queue;
@@ -23,6 +23,7 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "PreparedStatement.h"
+#include <algorithm>
 
 template<typename T>
 struct MySQLType { };
@@ -54,6 +55,40 @@ MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string_view
     mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &bool_tmp);
 }
 
+void MySQLPreparedStatement::SetCoalescing(StatementCoalescing coalescing)
+{
+    _coalescing = coalescing;
+
+    if (coalescing != StatementCoalescing::MultiRow)
+        return;
+
+    // Find the single row of values, every parameter must be part of it so it can be repeated
+    std::string upperQuery(_queryString);
+    std::transform(upperQuery.begin(), upperQuery.end(), upperQuery.begin(), ::toupper);
+
+    std::size_t values = upperQuery.find(" VALUES");
+    _rowBegin = values != std::string::npos ? _queryString.find('(', values) : std::string::npos;
+    _rowEnd = std::string::npos;
+
+    for (std::size_t i = _rowBegin, depth = 0; i < _queryString.size(); ++i)
+    {
+        if (_queryString[i] == '(')
+            ++depth;
+        else if (_queryString[i] == ')' && !--depth)
+        {
+            _rowEnd = i + 1;
+            break;
+        }
+    }
+
+    if (_rowEnd == std::string::npos || std::count(_queryString.begin() + _rowBegin, _queryString.begin() + _rowEnd, '?') != _paramCount)
+    {
+        LOG_ERROR("db.connection", "Statement \"{}\" can't be coalesced into multiple rows, sending it as multiple statements instead", _queryString);
+        _coalescing = StatementCoalescing::MultiStatement;
+        _rowBegin = _rowEnd = 0;
+    }
+}
+
 MySQLPreparedStatement::~MySQLPreparedStatement()
 {
     ClearParameters();
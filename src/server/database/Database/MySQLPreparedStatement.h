@@ -41,6 +41,9 @@ public:
 
     [[nodiscard]] uint32 GetParameterCount() const { return _paramCount; }
 
+    void SetCoalescing(StatementCoalescing coalescing);
+    [[nodiscard]] StatementCoalescing GetCoalescing() const { return _coalescing; }
+
 protected:
     void SetParameter(uint8 index, bool value);
     void SetParameter(uint8 index, std::nullptr_t /*value*/);
@@ -63,6 +66,9 @@ private:
     std::vector<bool> _paramsSet;
     MySQLBind* _bind{ nullptr };
     std::string _queryString;
+    StatementCoalescing _coalescing{ StatementCoalescing::None };
+    std::size_t _rowBegin{};    ///< "(?, ?, ...)" row of a StatementCoalescing::MultiRow statement in _queryString
+    std::size_t _rowEnd{};
 
     MySQLPreparedStatement(MySQLPreparedStatement const& right) = delete;
     MySQLPreparedStatement& operator=(MySQLPreparedStatement const& right) = delete;
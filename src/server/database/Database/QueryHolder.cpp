@@ -66,13 +66,45 @@ void SQLQueryHolderBase::SetSize(size_t size)
 void SQLQueryHolderTask::ExecuteQuery()
 {
     /// execute all queries in the holder and pass the results
-    for (size_t i = 0; i < _holder->_queries.size(); ++i)
-        if (auto stmt = _holder->_queries[i].first)
-            _holder->SetPreparedResult(i, _connection->Query(stmt));
+    if (!_batched || !ExecuteBatch())
+    {
+        for (size_t i = 0; i < _holder->_queries.size(); ++i)
+            if (auto stmt = _holder->_queries[i].first)
+                _holder->SetPreparedResult(i, _connection->Query(stmt));
+    }
 
     _result.set_value();
 }
 
+bool SQLQueryHolderTask::ExecuteBatch()
+{
+    std::vector<std::size_t> indexes;
+    std::vector<PreparedStatement> stmts;
+    indexes.reserve(_holder->_queries.size());
+    stmts.reserve(_holder->_queries.size());
+
+    for (size_t i = 0; i < _holder->_queries.size(); ++i)
+    {
+        if (auto const& stmt = _holder->_queries[i].first)
+        {
+            indexes.emplace_back(i);
+            stmts.emplace_back(stmt);
+        }
+    }
+
+    std::vector<PreparedQueryResult> results;
+    if (!_connection->QueryBatch(stmts, results))
+    {
+        LOG_WARN("db.query", "Failed to execute query holder as a batch of {} statements, falling back to single queries", stmts.size());
+        return false;
+    }
+
+    for (std::size_t i = 0; i < indexes.size(); ++i)
+        _holder->SetPreparedResult(indexes[i], std::move(results[i]));
+
+    return true;
+}
+
 bool SQLQueryHolderCallback::InvokeIfReady()
 {
     if (_future.valid() && _future.wait_for(0s) == std::future_status::ready)
@@ -34,15 +34,21 @@ public:
     void SetPreparedResult(std::size_t index, PreparedQueryResult result);
     bool SetPreparedQuery(std::size_t index, PreparedStatement stmt);
 
+    //! Allows the pool to send all queries of this holder in one multi-statement round trip.
+    //! Only suitable for holders made of read-only statements, they may be executed again one by one if the batch fails.
+    void SetBatched(bool batched) { _batched = batched; }
+    [[nodiscard]] bool IsBatched() const { return _batched; }
+
 private:
     std::vector<std::pair<PreparedStatement, PreparedQueryResult>> _queries;
+    bool _batched{};
 };
 
 class WH_DATABASE_API SQLQueryHolderTask : public AsyncOperation
 {
 public:
-    explicit SQLQueryHolderTask(SQLQueryHolder holder) :
-        AsyncOperation(), _holder(std::move(holder)) { }
+    explicit SQLQueryHolderTask(SQLQueryHolder holder, bool batched = false) :
+        AsyncOperation(), _holder(std::move(holder)), _batched(batched) { }
 
     ~SQLQueryHolderTask() override = default;
 
@@ -50,8 +56,11 @@ public:
     QueryResultHolderFuture GetFuture() { return _result.get_future(); }
 
 private:
+    bool ExecuteBatch();
+
     std::shared_ptr<SQLQueryHolderBase> _holder;
     QueryResultHolderPromise _result;
+    bool _batched;
 };
 
 class WH_DATABASE_API SQLQueryHolderCallback
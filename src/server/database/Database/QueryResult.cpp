@@ -368,6 +368,44 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     mysql_stmt_free_result(_stmt);
 }
 
+PreparedResultSet::PreparedResultSet(MySQLResult* result, uint64 rowCount, uint32 fieldCount) :
+    _rowCount(rowCount),
+    _fieldCount(fieldCount),
+    _metadataResult(result)
+{
+    if (!_metadataResult)
+        return;
+
+    auto* field = reinterpret_cast<MySQLField*>(mysql_fetch_fields(_metadataResult));
+    _fieldMetadata.resize(_fieldCount);
+
+    for (uint32 i = 0; i < _fieldCount; ++i)
+        InitializeDatabaseFieldMetadata(&_fieldMetadata[i], &field[i], i);
+
+    _rows.resize(uint32(_rowCount) * _fieldCount);
+
+    for (; _rowPosition < _rowCount; ++_rowPosition)
+    {
+        MYSQL_ROW row = mysql_fetch_row(_metadataResult);
+        unsigned long* lengths = row ? mysql_fetch_lengths(_metadataResult) : nullptr;
+        if (!lengths)
+        {
+            LOG_WARN("db.query", "{}:mysql_fetch_row, cannot retrieve row {} of {}. Error {}.", __FUNCTION__, _rowPosition, _rowCount, mysql_error(_metadataResult->handle));
+            _rowCount = _rowPosition;
+            break;
+        }
+
+        for (uint32 fIndex = 0; fIndex < _fieldCount; ++fIndex)
+        {
+            Field& rowField = _rows[uint32(_rowPosition) * _fieldCount + fIndex];
+            rowField.SetMetadata(&_fieldMetadata[fIndex]);
+            rowField.SetStructuredValue(row[fIndex], lengths[fIndex]);
+        }
+    }
+
+    _rowPosition = 0;
+}
+
 PreparedResultSet::~PreparedResultSet()
 {
     CleanUp();
@@ -425,3 +463,8 @@ void PreparedResultSet::AssertRows(std::size_t sizeRows) const
     ASSERT(_rowPosition < _rowCount);
     ASSERT(sizeRows == _fieldCount, "> Tuple size != count fields");
 }
+
+void PreparedResultSet::AssertColumn(uint32 index) const
+{
+    ASSERT(index < _fieldCount, "> Column {} out of {} fields", index, _fieldCount);
+}
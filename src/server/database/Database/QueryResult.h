@@ -20,6 +20,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Field.h"
+#include <tuple>
 #include <unordered_map>
 
 template<typename T>
@@ -43,6 +44,59 @@ private:
     pointer _ptr;
 };
 
+namespace Warhead::Impl
+{
+    template<typename... Ts, std::size_t... Is>
+    inline std::tuple<Ts...> ReadRow(Field const* row, std::index_sequence<Is...>)
+    {
+        return { row[Is].GetUnchecked<Ts>()... };
+    }
+}
+
+/// Typed view over one column of a buffered result, values are read in place without copying the rows
+template<typename T>
+class ResultColumn
+{
+public:
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = void;
+        using reference         = T;
+
+        Iterator(Field const* field, uint32 stride) : _field(field), _stride(stride) { }
+
+        T operator*() const { return _field->GetUnchecked<T>(); }
+        Iterator& operator++() { _field += _stride; return *this; }
+
+        bool operator!=(Iterator const& right) const { return _field != right._field; }
+        bool operator==(Iterator const& right) const { return _field == right._field; }
+
+    private:
+        Field const* _field;
+        uint32 _stride;
+    };
+
+    ResultColumn(Field const* first, uint32 stride, std::size_t size) : _first(first), _stride(stride), _size(size) { }
+
+    [[nodiscard]] std::size_t size() const { return _size; }
+    [[nodiscard]] bool empty() const { return !_size; }
+
+    T operator[](std::size_t row) const { return _first[row * _stride].template GetUnchecked<T>(); }
+    [[nodiscard]] bool IsNull(std::size_t row) const { return _first[row * _stride].IsNull(); }
+
+    [[nodiscard]] Iterator begin() const { return { _first, _stride }; }
+    [[nodiscard]] Iterator end() const { return { _first + _size * _stride, _stride }; }
+
+private:
+    Field const* _first;
+    uint32 _stride;
+    std::size_t _size;
+};
+
 class WH_DATABASE_API ResultSet
 {
 public:
@@ -73,6 +127,14 @@ public:
         return theTuple;
     }
 
+    //! Current row as a tuple, read with Field::GetUnchecked. Meant for bulk loaders with a known column layout.
+    template<typename... Ts>
+    inline std::tuple<Ts...> As() const
+    {
+        AssertRows(sizeof...(Ts));
+        return Warhead::Impl::ReadRow<Ts...>(_currRow.get(), std::index_sequence_for<Ts...>{});
+    }
+
     auto begin()      { return ResultIterator<ResultSet>(this); }
     static auto end() { return ResultIterator<ResultSet>(nullptr); }
 
@@ -97,6 +159,10 @@ class WH_DATABASE_API PreparedResultSet
 {
 public:
     PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount);
+
+    //! Buffers a text protocol result (one part of a multi-statement batch) so callers can keep using it as a prepared result.
+    //! Takes ownership of the result, field values point into its row storage.
+    PreparedResultSet(MySQLResult* result, uint64 rowCount, uint32 fieldCount);
     ~PreparedResultSet();
 
     bool NextRow();
@@ -122,6 +188,22 @@ public:
         return theTuple;
     }
 
+    //! Current row as a tuple, read with Field::GetUnchecked. Meant for bulk loaders with a known column layout.
+    template<typename... Ts>
+    inline std::tuple<Ts...> As() const
+    {
+        AssertRows(sizeof...(Ts));
+        return Warhead::Impl::ReadRow<Ts...>(&_rows[uint32(_rowPosition) * _fieldCount], std::index_sequence_for<Ts...>{});
+    }
+
+    //! All rows of one column, the whole result is buffered so it can be walked independently of NextRow
+    template<typename T>
+    [[nodiscard]] ResultColumn<T> GetColumn(uint32 index) const
+    {
+        AssertColumn(index);
+        return { _rows.data() + index, _fieldCount, std::size_t(_rowCount) };
+    }
+
     auto begin()        { return ResultIterator<PreparedResultSet>(this); }
     static auto end()   { return ResultIterator<PreparedResultSet>(nullptr); }
 
@@ -134,13 +216,14 @@ protected:
 
 private:
     MySQLBind* _rBind{ nullptr };
-    MySQLStmt* _stmt;
+    MySQLStmt* _stmt{ nullptr };
     MySQLResult* _metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
 
     void CleanUp();
     bool _NextRow();
 
     void AssertRows(std::size_t sizeRows) const;
+    void AssertColumn(uint32 index) const;
 
     PreparedResultSet(PreparedResultSet const& right) = delete;
     PreparedResultSet& operator=(PreparedResultSet const& right) = delete;
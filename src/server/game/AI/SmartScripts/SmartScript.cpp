@@ -95,21 +95,33 @@ void SmartScript::OnReset()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+    if (e == SMART_EVENT_LINK || e >= SMART_EVENT_AC_END)//special handling
+        return;
+
+    // Index into mEvents on every step, an action may install new events meanwhile
+    for (uint32 i = mEventTypeOffsets[e], end = mEventTypeOffsets[e + 1]; i < end; ++i)
     {
-        SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
+        SmartScriptHolder& holder = mEvents[mEventsByType[i]];
 
-        if (eventType == e)
-        {
-            ConditionList conds = sConditionMgr->GetConditionsForSmartEvent((*i).entryOrGuid, (*i).event_id, (*i).source_type);
-            ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
+        if (CheckConditions(holder, unit))
+            ProcessEvent(holder, unit, var0, var1, bvar, spell, gob);
+    }
+}
 
-            if (sConditionMgr->IsObjectMeetToConditions(info, conds))
-                ProcessEvent(*i, unit, var0, var1, bvar, spell, gob);
-        }
+bool SmartScript::CheckConditions(SmartScriptHolder& e, Unit* unit)
+{
+    uint32 generation = sConditionMgr->GetLoadGeneration();
+    if (e.conditionsGeneration != generation)
+    {
+        e.conditions = sConditionMgr->FindConditionsForSmartEvent(e.entryOrGuid, e.event_id, e.source_type);
+        e.conditionsGeneration = generation;
     }
+
+    if (!e.conditions)
+        return true;
+
+    ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
+    return sConditionMgr->IsObjectMeetToConditions(info, *e.conditions);
 }
 
 void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
@@ -2706,10 +2718,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 void SmartScript::ProcessTimedAction(SmartScriptHolder& e, uint32 const& min, uint32 const& max, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
     // xinef: extended by selfs victim
-    ConditionList const conds = sConditionMgr->GetConditionsForSmartEvent(e.entryOrGuid, e.event_id, e.source_type);
-    ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
-
-    if (sConditionMgr->IsObjectMeetToConditions(info, conds))
+    if (CheckConditions(e, unit))
     {
         ProcessAction(e, unit, var0, var1, bvar, spell, gob);
         RecalcTimer(e, min, max);
@@ -4157,9 +4166,32 @@ void SmartScript::InstallEvents()
             mEvents.push_back(*i);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        BuildEventIndex();
     }
 }
 
+void SmartScript::BuildEventIndex()
+{
+    // Counting sort of the event indexes by type, keeps the script order within each type
+    mEventTypeOffsets.fill(0);
+
+    for (SmartScriptHolder const& e : mEvents)
+        if (e.GetEventType() < SMART_EVENT_AC_END)
+            ++mEventTypeOffsets[e.GetEventType() + 1];
+
+    for (std::size_t i = 1; i < mEventTypeOffsets.size(); ++i)
+        mEventTypeOffsets[i] += mEventTypeOffsets[i - 1];
+
+    mEventsByType.resize(mEventTypeOffsets.back());
+
+    std::array<uint32, SMART_EVENT_AC_END> next;
+    std::copy_n(mEventTypeOffsets.begin(), next.size(), next.begin());
+
+    for (uint32 i = 0; i < mEvents.size(); ++i)
+        if (mEvents[i].GetEventType() < SMART_EVENT_AC_END)
+            mEventsByType[next[mEvents[i].GetEventType()]++] = i;
+}
+
 void SmartScript::OnUpdate(uint32 const diff)
 {
     if ((mScriptType == SMART_SCRIPT_TYPE_CREATURE || mScriptType == SMART_SCRIPT_TYPE_GAMEOBJECT) && !GetBaseObject())
@@ -4255,6 +4287,8 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger c
         }
         mEvents.push_back((*i));//NOTE: 'world(0)' events still get processed in ANY instance mode
     }
+
+    BuildEventIndex();
 }
 
 void SmartScript::GetScript()
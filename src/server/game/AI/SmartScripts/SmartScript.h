@@ -139,6 +139,8 @@ private:
     bool IsInPhase(uint32 p) const;
 
     SmartAIEventList mEvents;
+    std::vector<uint32> mEventsByType;                                   // mEvents indexes grouped by event type, in script order
+    std::array<uint32, SMART_EVENT_AC_END + 1> mEventTypeOffsets{};      // range of each event type in mEventsByType
     SmartAIEventList mInstallEvents;
     SmartAIEventList mTimedActionList;
     bool isProcessingTimedActionList;
@@ -176,6 +178,10 @@ private:
 
     SMARTAI_TEMPLATE mTemplate;
     void InstallEvents();
+    void BuildEventIndex();
+
+    // Conditions of the event are looked up once and kept on the holder until the conditions get reloaded
+    bool CheckConditions(SmartScriptHolder& e, Unit* unit);
 
     void RemoveStoredEvent(uint32 id)
     {
@@ -1797,6 +1797,10 @@ public:
     bool active;
     bool runOnce;
     bool enableTimed;
+
+    // Resolved by SmartScript::CheckConditions, nullptr if the event has no conditions
+    ConditionList const* conditions{ nullptr };
+    uint32 conditionsGeneration{ 0 };
 };
 
 typedef std::unordered_map<uint32, WayPoint*> WPPath;
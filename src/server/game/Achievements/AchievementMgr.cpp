@@ -511,6 +511,7 @@ void AchievementMgr::Reset()
 
     _completedAchievements.clear();
     _criteriaProgress.clear();
+    _closedCriteria.clear();
     DeleteFromDB(_player->GetGUID().GetCounter());
 
     // re-fill data
@@ -859,12 +860,18 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
+        if (IsClosedCriteria(achievementCriteria->ID))
+            continue;
+
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
         if (!achievement)
             continue;
 
         if (!CanUpdateCriteria(achievementCriteria, achievement))
+        {
+            TryCloseCriteria(achievementCriteria, achievement);
             continue;
+        }
 
         if (!sScriptMgr->CanCheckCriteria(this, achievementCriteria))
             continue;
@@ -2391,6 +2398,22 @@ bool AchievementMgr::CanUpdateCriteria(AchievementCriteriaEntry const* criteria,
     return true;
 }
 
+// Criteria of an earned achievement stay completed, skip them on the next events without any lookup
+void AchievementMgr::TryCloseCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement)
+{
+    // counters never complete, realm firsts become updatable again once the realm has them
+    if (achievement->flags & (ACHIEVEMENT_FLAG_COUNTER | ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
+        return;
+
+    if (!HasAchieved(achievement->ID) || !IsCompletedCriteria(criteria, achievement))
+        return;
+
+    if (_closedCriteria.size() <= criteria->ID)
+        _closedCriteria.resize(std::max<std::size_t>(sAchievementCriteriaStore.GetNumRows(), criteria->ID + 1));
+
+    _closedCriteria[criteria->ID] = true;
+}
+
 AchievementGlobalMgr* AchievementGlobalMgr::instance()
 {
     static AchievementGlobalMgr instance;
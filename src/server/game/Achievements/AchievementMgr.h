@@ -299,6 +299,8 @@ private:
     bool IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
     bool IsCompletedAchievement(AchievementEntry const* entry);
     bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement);
+    [[nodiscard]] bool IsClosedCriteria(uint32 criteriaId) const { return criteriaId < _closedCriteria.size() && _closedCriteria[criteriaId]; }
+    void TryCloseCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement);
     void BuildAllDataPacket(WorldPacket* data) const;
 
     Player* _player;
@@ -306,6 +308,7 @@ private:
     CompletedAchievementMap _completedAchievements;
     typedef std::map<uint32, uint32> TimedAchievementMap;
     TimedAchievementMap _timedAchievements;      // Criteria id/time left in MS
+    std::vector<bool> _closedCriteria;           // by criteria id, criteria of earned achievements that can't progress anymore
 };
 
 class WH_GAME_API AchievementGlobalMgr
@@ -324,11 +327,10 @@ public:
         return &_achievementCriteriasByType[type];
     }
 
-    AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val) const
     {
-        if (_specialList[type].find(val) != _specialList[type].end())
-            return &_specialList[type][val];
-        return nullptr;
+        auto itr = _specialList[type].find(val);
+        return itr != _specialList[type].end() ? &itr->second : nullptr;
     }
 
     AchievementCriteriaEntryList const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val)
@@ -395,7 +397,7 @@ private:
     AchievementRewards _achievementRewards;
 
     // pussywizard:
-    std::map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    std::unordered_map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
     std::map<uint32, AchievementCriteriaEntryList> _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
 };
 
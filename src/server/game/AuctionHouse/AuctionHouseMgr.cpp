@@ -35,6 +35,7 @@
 #include "StopWatch.h"
 #include "UpdateTime.h"
 #include "WorldPacket.h"
+#include <array>
 #include <sstream>
 #include <vector>
 
@@ -599,10 +600,39 @@ bool AuctionHouseMgr::RemoveAItem(ObjectGuid itemGuid, bool deleteFromDB, Charac
 
 void AuctionHouseMgr::Update()
 {
-    sScriptMgr->OnBeforeAuctionHouseMgrUpdate();
-    mHordeAuctions.Update();
-    mAllianceAuctions.Update();
-    mNeutralAuctions.Update();
+    time_t curTime = GameTime::GetGameTime().count();
+    uint32 batchSize = std::max<uint32>(CONF_GET_UINT("Auction.ExpiredSweep.BatchSize"), 1);
+
+    // All houses share one batch, oldest expired auction first, so a backlog in one house can't starve the others
+    std::array<AuctionHouseObject*, 3> houses = { &mHordeAuctions, &mAllianceAuctions, &mNeutralAuctions };
+    CharacterDatabaseTransaction trans;
+
+    for (uint32 count = 0; count < batchSize; ++count)
+    {
+        AuctionHouseObject* nextHouse = nullptr;
+        time_t nextExpireTime = curTime;
+
+        for (AuctionHouseObject* house : houses)
+        {
+            time_t expireTime = house->GetNextExpireTime();
+            if (expireTime <= nextExpireTime)
+            {
+                nextHouse = house;
+                nextExpireTime = expireTime;
+            }
+        }
+
+        if (!nextHouse)
+            break;
+
+        if (!trans)
+            trans = CharacterDatabase.BeginTransaction();
+
+        nextHouse->ExpireNextAuction(trans);
+    }
+
+    if (trans)
+        CharacterDatabase.CommitTransaction(trans);
 }
 
 AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(uint32 factionTemplateId)
@@ -638,12 +668,14 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
     ASSERT(auction);
 
     AuctionsMap[auction->Id] = auction;
+    AuctionsExpireQueue.emplace(auction->expire_time, auction->Id);
     sScriptMgr->OnAuctionAdd(this, auction);
 }
 
 bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
 {
     bool wasInMap = !!AuctionsMap.erase(auction->Id);
+    AuctionsExpireQueue.erase({ auction->expire_time, auction->Id });
 
     sScriptMgr->OnAuctionRemove(this, auction);
 
@@ -654,49 +686,35 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
     return wasInMap;
 }
 
-void AuctionHouseObject::Update()
+void AuctionHouseObject::ExpireNextAuction(CharacterDatabaseTransaction trans)
 {
-    time_t checkTime = GameTime::GetGameTime().count() + 60;
-    ///- Handle expired auctions
-
-    // If storage is empty, no need to update. next == nullptr in this case.
-    if (AuctionsMap.empty())
-        return;
+    ASSERT(!AuctionsExpireQueue.empty());
 
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    AuctionEntry* auction = GetAuction(AuctionsExpireQueue.begin()->second);
+    ASSERT(auction);
 
-    for (AuctionEntryMap::iterator itr, iter = AuctionsMap.begin(); iter != AuctionsMap.end(); )
+    ///- Either cancel the auction if there was no bidder
+    if (!auction->bidder)
     {
-        itr = iter++;
-        AuctionEntry* auction = (*itr).second;
-
-        if (auction->expire_time > checkTime)
-            continue;
-
-        ///- Either cancel the auction if there was no bidder
-        if (!auction->bidder)
-        {
-            sAuctionMgr->SendAuctionExpiredMail(auction, trans);
-            sScriptMgr->OnAuctionExpire(this, auction);
-        }
-        ///- Or perform the transaction
-        else
-        {
-            //we should send an "item sold" message if the seller is online
-            //we send the item to the winner
-            //we send the money to the seller
-            sAuctionMgr->SendAuctionSuccessfulMail(auction, trans);
-            sAuctionMgr->SendAuctionWonMail(auction, trans);
-            sScriptMgr->OnAuctionSuccessful(this, auction);
-        }
+        sAuctionMgr->SendAuctionExpiredMail(auction, trans);
+        sScriptMgr->OnAuctionExpire(this, auction);
+    }
+    ///- Or perform the transaction
+    else
+    {
+        //we should send an "item sold" message if the seller is online
+        //we send the item to the winner
+        //we send the money to the seller
+        sAuctionMgr->SendAuctionSuccessfulMail(auction, trans);
+        sAuctionMgr->SendAuctionWonMail(auction, trans);
+        sScriptMgr->OnAuctionSuccessful(this, auction);
+    }
 
-        ///- In any case clear the auction
-        auction->DeleteFromDB(trans);
+    ///- In any case clear the auction
+    auction->DeleteFromDB(trans);
 
-        sAuctionMgr->RemoveAItem(auction->item_guid);
-        RemoveAuction(auction);
-    }
-    CharacterDatabase.CommitTransaction(trans);
+    sAuctionMgr->RemoveAItem(auction->item_guid);
+    RemoveAuction(auction);
 }
 
 void AuctionHouseObject::BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount)
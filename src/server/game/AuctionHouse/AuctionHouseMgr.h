@@ -24,6 +24,8 @@
 #include "EventProcessor.h"
 #include "ObjectGuid.h"
 #include "WorldPacket.h"
+#include <limits>
+#include <set>
 #include <unordered_map>
 
 class Item;
@@ -130,7 +132,7 @@ class WH_GAME_API AuctionHouseObject
 {
 public:
     // Initialize storage
-    AuctionHouseObject() { next = AuctionsMap.begin(); }
+    AuctionHouseObject() = default;
 
     ~AuctionHouseObject()
     {
@@ -139,6 +141,7 @@ public:
     }
 
     typedef std::map<uint32, AuctionEntry*> AuctionEntryMap;
+    typedef std::set<std::pair<time_t, uint32>> AuctionExpireQueue;
 
     [[nodiscard]] uint32 Getcount() const { return AuctionsMap.size(); }
 
@@ -156,7 +159,11 @@ public:
 
     bool RemoveAuction(AuctionEntry* auction);
 
-    void Update();
+    // Returns the expire time of the auction ending first, or the max time_t if there are no auctions
+    [[nodiscard]] time_t GetNextExpireTime() const { return AuctionsExpireQueue.empty() ? std::numeric_limits<time_t>::max() : AuctionsExpireQueue.begin()->first; }
+
+    // Ends the auction expiring first, sending its mails within the given transaction
+    void ExpireNextAuction(CharacterDatabaseTransaction trans);
 
     void BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
     void BuildListOwnerItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
@@ -168,8 +175,8 @@ public:
 private:
     AuctionEntryMap AuctionsMap;
 
-    // storage for "next" auction item for next Update()
-    AuctionEntryMap::const_iterator next;
+    // auctions ordered by expire time, then id
+    AuctionExpireQueue AuctionsExpireQueue;
 };
 
 class WH_GAME_API AuctionHouseMgr
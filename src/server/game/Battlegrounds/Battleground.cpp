@@ -583,13 +583,25 @@ inline void Battleground::_ProcessLeave(uint32 diff)
     if (m_EndTime <= 0)
     {
         m_EndTime = TIME_TO_AUTOREMOVE; // pussywizard: 0 -> TIME_TO_AUTOREMOVE
-        BattlegroundPlayerMap::iterator itr, next;
-        for (itr = m_Players.begin(); itr != m_Players.end(); itr = next)
-        {
-            next = itr;
-            ++next;
-            itr->second->LeaveBattleground(this); //itr is erased here!
-        }
+
+        // leaving touches groups and queues shared with other battlegrounds, done in ProcessDeferredLeave
+        m_RemoveAllPlayersPending = true;
+    }
+}
+
+void Battleground::ProcessDeferredLeave()
+{
+    if (!m_RemoveAllPlayersPending)
+        return;
+
+    m_RemoveAllPlayersPending = false;
+
+    BattlegroundPlayerMap::iterator itr, next;
+    for (itr = m_Players.begin(); itr != m_Players.end(); itr = next)
+    {
+        next = itr;
+        ++next;
+        itr->second->LeaveBattleground(this); //itr is erased here!
     }
 }
 
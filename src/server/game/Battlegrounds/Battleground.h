@@ -289,8 +289,12 @@ public:
     Battleground();
     virtual ~Battleground();
 
+    // Called from the owning BattlegroundMap update (map threads), or from BattlegroundMgr::Update while there is no map yet
     void Update(uint32 diff);
 
+    // Serial part of the update, run by BattlegroundMgr::Update: teleports out all players once the leave timer expired
+    void ProcessDeferredLeave();
+
     virtual bool SetupBattleground()                    // must be implemented in BG subclass
     {
         return true;
@@ -643,6 +647,7 @@ private:
     uint8  m_ArenaType;                                 // 2=2v2, 3=3v3, 5=5v5
     bool   _InBGFreeSlotQueue{ false };                // used to make sure that BG is only once inserted into the BattlegroundMgr.BGFreeSlotQueue[bgTypeId] deque
     bool   m_SetDeleteThis;                             // used for safe deletion of the bg after end / all players leave
+    bool   m_RemoveAllPlayersPending{ false };          // set by _ProcessLeave, players are removed in ProcessDeferredLeave
     bool   m_IsArena;
     PvPTeamId m_WinnerId;
     int32  m_StartDelayTime;
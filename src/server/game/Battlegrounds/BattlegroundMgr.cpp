@@ -104,7 +104,8 @@ void BattlegroundMgr::DeleteAllBattlegrounds()
 // used to update running battlegrounds, and delete finished ones
 void BattlegroundMgr::Update(uint32 diff)
 {
-    // update all battlegrounds and delete if needed
+    // battlegrounds with a map were already updated by their BattlegroundMap on the map threads,
+    // only the cross battleground bookkeeping and the deletion are done here
     for (auto& [_, bgData] : bgDataStore)
     {
         auto& bgList = bgData._Battlegrounds;
@@ -116,7 +117,11 @@ void BattlegroundMgr::Update(uint32 diff)
             itrDelete = itr++;
             Battleground* bg = itrDelete->second;
 
-            bg->Update(diff);
+            if (!bg->FindBgMap())
+                bg->Update(diff);
+
+            bg->ProcessDeferredLeave();
+
             if (bg->ToBeDeleted())
             {
                 itrDelete->second = nullptr;
@@ -136,21 +141,21 @@ void BattlegroundMgr::Update(uint32 diff)
         m_BattlegroundQueues[qtype].UpdateEvents(diff);
 
     // update using scheduled tasks (used only for rated arenas, initial opponent search works differently than periodic queue update)
-    if (!m_QueueUpdateScheduler.empty())
+    std::vector<uint64> scheduled;
     {
-        std::vector<uint64> scheduled;
+        std::lock_guard<std::mutex> guard(_bookkeepingLock);
         std::swap(scheduled, m_QueueUpdateScheduler);
+    }
 
-        for (uint8 i = 0; i < scheduled.size(); i++)
-        {
-            uint32 arenaMMRating = scheduled[i] >> 32;
-            uint8 arenaType = scheduled[i] >> 24 & 255;
-            BattlegroundQueueTypeId bgQueueTypeId = BattlegroundQueueTypeId(scheduled[i] >> 16 & 255);
-            BattlegroundTypeId bgTypeId = BattlegroundTypeId((scheduled[i] >> 8) & 255);
-            BattlegroundBracketId bracket_id = BattlegroundBracketId(scheduled[i] & 255);
-            m_BattlegroundQueues[bgQueueTypeId].BattlegroundQueueUpdate(diff, bgTypeId, bracket_id, arenaType, arenaMMRating > 0, arenaMMRating);
-            m_BattlegroundQueues[bgQueueTypeId].BattlegroundQueueAnnouncerUpdate(diff, bgQueueTypeId, bracket_id);
-        }
+    for (uint64 scheduleId : scheduled)
+    {
+        uint32 arenaMMRating = scheduleId >> 32;
+        uint8 arenaType = scheduleId >> 24 & 255;
+        BattlegroundQueueTypeId bgQueueTypeId = BattlegroundQueueTypeId(scheduleId >> 16 & 255);
+        BattlegroundTypeId bgTypeId = BattlegroundTypeId((scheduleId >> 8) & 255);
+        BattlegroundBracketId bracket_id = BattlegroundBracketId(scheduleId & 255);
+        m_BattlegroundQueues[bgQueueTypeId].BattlegroundQueueUpdate(diff, bgTypeId, bracket_id, arenaType, arenaMMRating > 0, arenaMMRating);
+        m_BattlegroundQueues[bgQueueTypeId].BattlegroundQueueAnnouncerUpdate(diff, bgQueueTypeId, bracket_id);
     }
 
     // periodic queue update
@@ -759,9 +764,11 @@ void BattlegroundMgr::SetHolidayWeekends(uint32 mask)
 
 void BattlegroundMgr::ScheduleQueueUpdate(uint32 arenaMatchmakerRating, uint8 arenaType, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id)
 {
-    //This method must be atomic, @todo add mutex
     //we will use only 1 number created of bgTypeId and bracket_id
     uint64 const scheduleId = ((uint64)arenaMatchmakerRating << 32) | ((uint64)arenaType << 24) | ((uint64)bgQueueTypeId << 16) | ((uint64)bgTypeId << 8) | (uint64)bracket_id;
+
+    // can be called by battlegrounds ending on the map threads
+    std::lock_guard<std::mutex> guard(_bookkeepingLock);
     if (std::find(m_QueueUpdateScheduler.begin(), m_QueueUpdateScheduler.end(), scheduleId) == m_QueueUpdateScheduler.end())
         m_QueueUpdateScheduler.emplace_back(scheduleId);
 }
@@ -930,11 +937,13 @@ BGFreeSlotQueueContainer& BattlegroundMgr::GetBGFreeSlotQueueStore(BattlegroundT
 
 void BattlegroundMgr::AddToBGFreeSlotQueue(BattlegroundTypeId bgTypeId, Battleground* bg)
 {
+    std::lock_guard<std::mutex> guard(_bookkeepingLock);
     bgDataStore[bgTypeId].BGFreeSlotQueue.push_front(bg);
 }
 
 void BattlegroundMgr::RemoveFromBGFreeSlotQueue(BattlegroundTypeId bgTypeId, uint32 instanceId)
 {
+    std::lock_guard<std::mutex> guard(_bookkeepingLock);
     BGFreeSlotQueueContainer& queues = bgDataStore[bgTypeId].BGFreeSlotQueue;
     for (BGFreeSlotQueueContainer::iterator itr = queues.begin(); itr != queues.end(); ++itr)
         if ((*itr)->GetInstanceID() == instanceId)
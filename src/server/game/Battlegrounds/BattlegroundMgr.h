@@ -23,6 +23,7 @@
 #include "CreatureAIImpl.h"
 #include "DBCEnums.h"
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 
 typedef std::map<uint32, Battleground*> BattlegroundContainer;
@@ -151,6 +152,10 @@ private:
     BattlegroundQueue m_BattlegroundQueues[MAX_BATTLEGROUND_QUEUE_TYPES];
 
     std::vector<uint64> m_QueueUpdateScheduler;
+
+    // Battlegrounds are updated on the map threads, this guards the free slot queues and
+    // m_QueueUpdateScheduler against concurrent writers. They are only read from the world thread
+    std::mutex _bookkeepingLock;
     bool   m_ArenaTesting;
     bool   m_Testing;
     Seconds m_NextAutoDistributionTime;
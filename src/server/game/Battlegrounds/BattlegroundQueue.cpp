@@ -77,6 +77,16 @@ BattlegroundQueue::~BattlegroundQueue()
 /***      BATTLEGROUND QUEUE SELECTION POOLS           ***/
 /*********************************************************/
 
+void BattlegroundQueue::RemoveFromRatedArenaIndex(GroupQueueInfo* ginfo)
+{
+    if (!ginfo->RatedIndexSequence)
+        return;
+
+    for (RatedArenaQueueIndex& index : m_RatedArenaIndex[ginfo->BracketId])
+        if (index.Remove(ginfo))
+            return;
+}
+
 // selection pool initialization, used to clean up from prev selection
 void BattlegroundQueue::SelectionPool::Init()
 {
@@ -197,6 +207,9 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
     //add GroupInfo to m_QueuedGroups
     m_QueuedGroups[bracketId][ginfo->GroupType].emplace_back(ginfo);
 
+    if (isRated && arenaType)
+        m_RatedArenaIndex[bracketId][ginfo->GroupType].Add(ginfo);
+
     // announce world (this doesn't need mutex)
     SendJoinMessageArenaQueue(leader, ginfo, bracketEntry, isRated);
 
@@ -339,6 +352,7 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     // remove group queue info no players left
     if (groupInfo->Players.empty())
     {
+        RemoveFromRatedArenaIndex(groupInfo);
         m_QueuedGroups[_bracketId][_groupType].erase(group_itr);
         delete groupInfo;
         return;
@@ -828,20 +842,14 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
         // 0 is on (automatic update call) and we must set it to team's with longest wait time
         if (!arenaRating)
         {
-            GroupQueueInfo* front1 = nullptr;
-            GroupQueueInfo* front2 = nullptr;
+            GroupQueueInfo* front1 = m_RatedArenaIndex[bracket_id][TEAM_ALLIANCE].GetOldest();
+            GroupQueueInfo* front2 = m_RatedArenaIndex[bracket_id][TEAM_HORDE].GetOldest();
 
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty())
-            {
-                front1 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].front();
+            if (front1)
                 arenaRating = front1->ArenaMatchmakerRating;
-            }
 
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty())
-            {
-                front2 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].front();
+            if (front2)
                 arenaRating = front2->ArenaMatchmakerRating;
-            }
 
             if (front1 && front2)
             {
@@ -866,26 +874,18 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
         // timer for previous opponents
         Milliseconds discardOpponentsTime{ GameTime::GetGameTimeMS() - Milliseconds{ CONF_GET_UINT("Arena.PreviousOpponentsDiscardTimer") } };
 
-        // we need to find 2 teams which will play next game
-        GroupsQueueType::iterator itr_teams[PVP_TEAMS_COUNT];
+        // we need to find 2 teams which will play next game, the index only holds teams that are not invited yet
+        GroupQueueInfo* teams[PVP_TEAMS_COUNT] = { };
         uint8 found = 0;
         uint8 team = 0;
 
         for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
         {
             // take the group that joined first
-            GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][i].begin();
-            for (; itr2 != m_QueuedGroups[bracket_id][i].end(); ++itr2)
+            if (GroupQueueInfo* ginfo = m_RatedArenaIndex[bracket_id][i].SelectFirst(arenaMinRating, arenaMaxRating, discardTime))
             {
-                // if group match conditions, then add it to pool
-                if (!(*itr2)->IsInvitedToBGInstanceGUID
-                    && (((*itr2)->ArenaMatchmakerRating >= arenaMinRating && (*itr2)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (*itr2)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr2;
-                    team = i;
-                    break;
-                }
+                teams[found++] = ginfo;
+                team = i;
             }
         }
 
@@ -893,25 +893,14 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
             return;
 
         if (found == 1)
-        {
-            for (GroupsQueueType::iterator itr3 = itr_teams[0]; itr3 != m_QueuedGroups[bracket_id][team].end(); ++itr3)
-            {
-                if (!(*itr3)->IsInvitedToBGInstanceGUID
-                    && (((*itr3)->ArenaMatchmakerRating >= arenaMinRating && (*itr3)->ArenaMatchmakerRating <= arenaMaxRating) || (*itr3)->JoinTime < discardTime)
-                    && ((*itr_teams[0])->ArenaTeamId != (*itr3)->PreviousOpponentsTeamId || ((*itr3)->JoinTime < discardOpponentsTime))
-                    && (*itr_teams[0])->ArenaTeamId != (*itr3)->ArenaTeamId)
-                {
-                    itr_teams[found++] = itr3;
-                    break;
-                }
-            }
-        }
+            if (GroupQueueInfo* ginfo = m_RatedArenaIndex[bracket_id][team].SelectSecond(teams[0], arenaMinRating, arenaMaxRating, discardTime, discardOpponentsTime))
+                teams[found++] = ginfo;
 
         //if we have 2 teams, then start new arena and invite players!
         if (found == 2)
         {
-            GroupQueueInfo* aTeam = *itr_teams[TEAM_ALLIANCE];
-            GroupQueueInfo* hTeam = *itr_teams[TEAM_HORDE];
+            GroupQueueInfo* aTeam = teams[TEAM_ALLIANCE];
+            GroupQueueInfo* hTeam = teams[TEAM_HORDE];
 
             Battleground* arena = sBattlegroundMgr->CreateNewBattleground(bgTypeId, bracketEntry, arenaType, true);
             if (!arena)
@@ -928,19 +917,25 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
             LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", aTeam->ArenaTeamId, aTeam->OpponentsTeamRating);
             LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", hTeam->ArenaTeamId, hTeam->OpponentsTeamRating);
 
+            // leave the index before GroupType changes below
+            RemoveFromRatedArenaIndex(aTeam);
+            RemoveFromRatedArenaIndex(hTeam);
+
             // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
             if (aTeam->teamId != TEAM_ALLIANCE)
             {
+                GroupsQueueType& hordeGroups = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE];
                 aTeam->GroupType = BG_QUEUE_PREMADE_ALLIANCE;
                 m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
+                hordeGroups.erase(std::find(hordeGroups.begin(), hordeGroups.end(), aTeam));
             }
 
             if (hTeam->teamId != TEAM_HORDE)
             {
+                GroupsQueueType& allianceGroups = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE];
                 hTeam->GroupType = BG_QUEUE_PREMADE_HORDE;
                 m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
+                allianceGroups.erase(std::find(allianceGroups.begin(), allianceGroups.end(), hTeam));
             }
 
             arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
@@ -1196,6 +1191,7 @@ void BattlegroundQueue::InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg,
 
     // set invitation
     ginfo->IsInvitedToBGInstanceGUID = bg->GetInstanceID();
+    RemoveFromRatedArenaIndex(ginfo);
 
     BattlegroundTypeId bgTypeId = bg->GetBgTypeID();
     BattlegroundQueueTypeId bgQueueTypeId = BattlegroundMgr::BGQueueTypeId(ginfo->BgTypeId, ginfo->ArenaType);
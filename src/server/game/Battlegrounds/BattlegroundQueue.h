@@ -21,6 +21,7 @@
 #include "Battleground.h"
 #include "DBCEnums.h"
 #include "EventProcessor.h"
+#include "RatedArenaQueueIndex.h"
 #include <array>
 
 constexpr auto COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME = 10;
@@ -45,6 +46,7 @@ struct WH_GAME_API GroupQueueInfo                           // stores informatio
     uint32  PreviousOpponentsTeamId{};                      // excluded from the current queue until the timer is met
     uint8   BracketId{};                                    // BattlegroundBracketId
     uint8   GroupType{};                                    // BattlegroundQueueGroupTypes
+    uint64  RatedIndexSequence{};                           // position in the RatedArenaQueueIndex, 0 when not indexed
 };
 
 enum BattlegroundQueueGroupTypes
@@ -124,10 +126,15 @@ public:
     //one selection pool for horde, other one for alliance
     SelectionPool m_SelectionPools[PVP_TEAMS_COUNT];
 
+    // rated arena teams of BG_QUEUE_PREMADE_ALLIANCE / BG_QUEUE_PREMADE_HORDE that are not invited yet
+    RatedArenaQueueIndex m_RatedArenaIndex[MAX_BATTLEGROUND_BRACKETS][PVP_TEAMS_COUNT];
+
     void SetQueueAnnouncementTimer(uint32 bracketId, int32 timer, bool isCrossFactionBG = true);
     [[nodiscard]] int32 GetQueueAnnouncementTimer(uint32 bracketId) const;
 
 private:
+    void RemoveFromRatedArenaIndex(GroupQueueInfo* ginfo);
+
     uint32 m_WaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
     uint32 m_WaitTimeLastIndex[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
 
@@ -0,0 +1,152 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RatedArenaQueueIndex.h"
+#include "BattlegroundQueue.h"
+#include "Errors.h"
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    auto const SequenceLess = [](auto const& entry, uint64 sequence) { return entry.Sequence < sequence; };
+}
+
+void RatedArenaQueueIndex::Add(GroupQueueInfo* ginfo)
+{
+    ASSERT(!ginfo->RatedIndexSequence);
+
+    // sequences follow JoinTime, so appending keeps every list in join order
+    ginfo->RatedIndexSequence = ++_nextSequence;
+
+    uint32 bucket = ginfo->ArenaMatchmakerRating / BUCKET_SIZE;
+    if (bucket >= _buckets.size())
+        _buckets.resize(bucket + 1);
+
+    _byJoin.push_back({ ginfo->RatedIndexSequence, ginfo });
+    _buckets[bucket].push_back({ ginfo->RatedIndexSequence, ginfo });
+}
+
+bool RatedArenaQueueIndex::Remove(GroupQueueInfo* ginfo)
+{
+    if (!ginfo->RatedIndexSequence || !Erase(_byJoin, ginfo->RatedIndexSequence))
+        return false;
+
+    Erase(_buckets[ginfo->ArenaMatchmakerRating / BUCKET_SIZE], ginfo->RatedIndexSequence);
+    ginfo->RatedIndexSequence = 0;
+    return true;
+}
+
+void RatedArenaQueueIndex::Clear()
+{
+    for (Entry const& entry : _byJoin)
+        entry.Group->RatedIndexSequence = 0;
+
+    _byJoin.clear();
+    _buckets.clear();
+}
+
+GroupQueueInfo* RatedArenaQueueIndex::SelectFirst(uint32 minRating, uint32 maxRating, Milliseconds discardTime) const
+{
+    if (_byJoin.empty())
+        return nullptr;
+
+    // the oldest team ignores the rating window once it waited long enough, if it doesn't nobody does
+    GroupQueueInfo* oldest = _byJoin.front().Group;
+    if (oldest->JoinTime < discardTime)
+        return oldest;
+
+    GroupQueueInfo* selected = nullptr;
+    uint64 selectedSequence = std::numeric_limits<uint64>::max();
+
+    uint32 lastBucket = std::min<uint32>(maxRating / BUCKET_SIZE, uint32(_buckets.size()) - 1);
+    for (uint32 bucket = minRating / BUCKET_SIZE; bucket <= lastBucket && !_buckets.empty(); ++bucket)
+    {
+        for (Entry const& entry : _buckets[bucket])
+        {
+            if (entry.Sequence >= selectedSequence)
+                break;
+
+            uint32 rating = entry.Group->ArenaMatchmakerRating;
+            if (rating >= minRating && rating <= maxRating)
+            {
+                selected = entry.Group;
+                selectedSequence = entry.Sequence;
+                break;
+            }
+        }
+    }
+
+    return selected;
+}
+
+GroupQueueInfo* RatedArenaQueueIndex::SelectSecond(GroupQueueInfo const* first, uint32 minRating, uint32 maxRating, Milliseconds discardTime, Milliseconds discardOpponentsTime) const
+{
+    GroupQueueInfo* selected = nullptr;
+    uint64 selectedSequence = std::numeric_limits<uint64>::max();
+
+    // teams past the discard timer form a prefix of the join order
+    for (auto itr = std::lower_bound(_byJoin.begin(), _byJoin.end(), first->RatedIndexSequence + 1, SequenceLess); itr != _byJoin.end() && itr->Group->JoinTime < discardTime; ++itr)
+    {
+        if (CanPlayAgainst(first, itr->Group, discardOpponentsTime))
+        {
+            selected = itr->Group;
+            selectedSequence = itr->Sequence;
+            break;
+        }
+    }
+
+    if (_buckets.empty())
+        return selected;
+
+    uint32 lastBucket = std::min<uint32>(maxRating / BUCKET_SIZE, uint32(_buckets.size()) - 1);
+    for (uint32 bucket = minRating / BUCKET_SIZE; bucket <= lastBucket; ++bucket)
+    {
+        EntryList const& entries = _buckets[bucket];
+        for (auto itr = std::lower_bound(entries.begin(), entries.end(), first->RatedIndexSequence + 1, SequenceLess); itr != entries.end(); ++itr)
+        {
+            if (itr->Sequence >= selectedSequence)
+                break;
+
+            uint32 rating = itr->Group->ArenaMatchmakerRating;
+            if (rating >= minRating && rating <= maxRating && CanPlayAgainst(first, itr->Group, discardOpponentsTime))
+            {
+                selected = itr->Group;
+                selectedSequence = itr->Sequence;
+                break;
+            }
+        }
+    }
+
+    return selected;
+}
+
+bool RatedArenaQueueIndex::CanPlayAgainst(GroupQueueInfo const* first, GroupQueueInfo const* second, Milliseconds discardOpponentsTime)
+{
+    return (first->ArenaTeamId != second->PreviousOpponentsTeamId || second->JoinTime < discardOpponentsTime)
+        && first->ArenaTeamId != second->ArenaTeamId;
+}
+
+bool RatedArenaQueueIndex::Erase(EntryList& entries, uint64 sequence)
+{
+    auto itr = std::lower_bound(entries.begin(), entries.end(), sequence, SequenceLess);
+    if (itr == entries.end() || itr->Sequence != sequence)
+        return false;
+
+    entries.erase(itr);
+    return true;
+}
@@ -0,0 +1,69 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _RATED_ARENA_QUEUE_INDEX_H
+#define _RATED_ARENA_QUEUE_INDEX_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <vector>
+
+struct GroupQueueInfo;
+
+/*
+    Index of the rated arena teams waiting in one bracket and faction queue that were not invited yet.
+    Teams are kept in join order and in matchmaker rating buckets, both ordered by join sequence,
+    so the "oldest team in the rating window" lookups of BattlegroundQueueUpdate are range queries
+    over a few buckets instead of walks over the whole queue.
+*/
+class WH_GAME_API RatedArenaQueueIndex
+{
+public:
+    static constexpr uint32 BUCKET_SIZE = 100;
+
+    void Add(GroupQueueInfo* ginfo);
+    bool Remove(GroupQueueInfo* ginfo);
+    void Clear();
+
+    [[nodiscard]] bool IsEmpty() const { return _byJoin.empty(); }
+    [[nodiscard]] std::size_t GetSize() const { return _byJoin.size(); }
+    [[nodiscard]] GroupQueueInfo* GetOldest() const { return _byJoin.empty() ? nullptr : _byJoin.front().Group; }
+
+    // Oldest team with a rating in [minRating, maxRating] or that joined before discardTime
+    [[nodiscard]] GroupQueueInfo* SelectFirst(uint32 minRating, uint32 maxRating, Milliseconds discardTime) const;
+
+    // Oldest team that joined after first, matches like SelectFirst and may be matched against first
+    [[nodiscard]] GroupQueueInfo* SelectSecond(GroupQueueInfo const* first, uint32 minRating, uint32 maxRating, Milliseconds discardTime, Milliseconds discardOpponentsTime) const;
+
+private:
+    struct Entry
+    {
+        uint64 Sequence;
+        GroupQueueInfo* Group;
+    };
+
+    using EntryList = std::vector<Entry>;
+
+    static bool CanPlayAgainst(GroupQueueInfo const* first, GroupQueueInfo const* second, Milliseconds discardOpponentsTime);
+    static bool Erase(EntryList& entries, uint64 sequence);
+
+    uint64 _nextSequence{ 0 };
+    EntryList _byJoin;
+    std::vector<EntryList> _buckets;
+};
+
+#endif
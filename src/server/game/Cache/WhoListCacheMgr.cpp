@@ -21,7 +21,22 @@
 #include "WhoListCacheMgr.h"
 #include "GuildMgr.h"
 #include "ObjectAccessor.h"
-#include "World.h"
+#include "Player.h"
+#include <limits>
+
+bool WhoListQuery::Matches(WhoListPlayerInfo const& info) const
+{
+    if (info.GetLevel() < LevelMin || info.GetLevel() > LevelMax)
+        return false;
+
+    if (!(ClassMask & (1 << info.GetClass())) || !(RaceMask & (1 << info.GetRace())))
+        return false;
+
+    if (!ZonesCount)
+        return true;
+
+    return std::find(Zones.begin(), Zones.begin() + ZonesCount, info.GetZoneId()) != Zones.begin() + ZonesCount;
+}
 
 WhoListCacheMgr* WhoListCacheMgr::instance()
 {
@@ -29,36 +44,180 @@ WhoListCacheMgr* WhoListCacheMgr::instance()
     return &instance;
 }
 
+void WhoListCacheMgr::QueueUpdate(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(_queueLock);
+    _queue.push_back(guid);
+}
+
 void WhoListCacheMgr::Update()
 {
-    // clear current list
-    _whoListStorage.clear();
-    _whoListStorage.reserve(sWorld->GetPlayerCount() + 1);
+    std::vector<ObjectGuid> queue;
+
+    {
+        std::lock_guard<std::mutex> guard(_queueLock);
+        queue.swap(_queue);
+    }
+
+    // refreshing a player twice is harmless, no need to deduplicate
+    for (ObjectGuid const& guid : queue)
+        Refresh(guid);
+}
+
+void WhoListCacheMgr::Refresh(ObjectGuid guid)
+{
+    Player* player = ObjectAccessor::FindConnectedPlayer(guid);
+    if (!player || !player->FindMap() || player->GetSession()->PlayerLoading())
+    {
+        Remove(guid);
+        return;
+    }
 
-    for (auto const& [guid, player] : ObjectAccessor::GetPlayers())
+    uint32 slot;
+    auto itr = _slots.find(guid);
+    if (itr != _slots.end())
+    {
+        slot = itr->second;
+        UnlinkEntry(slot);
+    }
+    else if (!_freeSlots.empty())
+    {
+        slot = _freeSlots.back();
+        _freeSlots.pop_back();
+        _entries[slot] = WhoListPlayerInfo();
+    }
+    else
     {
-        if (!player->FindMap() || player->GetSession()->PlayerLoading())
-            continue;
+        slot = _entries.size();
+        _entries.emplace_back();
+    }
 
-        std::string playerName = player->GetName();
-        std::wstring widePlayerName;
+    WhoListPlayerInfo& info = _entries[slot];
 
-        if (!Utf8toWStr(playerName, widePlayerName))
-            continue;
+    // lower-cased names are only rebuilt when the name changed
+    if (info._playerName != player->GetName() || info._widePlayerName.empty())
+    {
+        info._playerName = player->GetName();
 
-        wstrToLower(widePlayerName);
+        if (!Utf8toWStr(info._playerName, info._widePlayerName))
+        {
+            _slots.erase(guid);
+            _freeSlots.push_back(slot);
+            return;
+        }
 
-        std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
-        std::wstring wideGuildName;
+        wstrToLower(info._widePlayerName);
+    }
 
-        if (!Utf8toWStr(guildName, wideGuildName))
-            continue;
+    std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
+    if (info._guildName != guildName)
+    {
+        if (!Utf8toWStr(guildName, info._wideGuildName))
+        {
+            _slots.erase(guid);
+            _freeSlots.push_back(slot);
+            return;
+        }
 
-        wstrToLower(wideGuildName);
+        wstrToLower(info._wideGuildName);
+        info._guildName = std::move(guildName);
+    }
+
+    info._guid = guid;
+    info._team = player->GetTeamId();
+    info._security = player->GetSession()->GetSecurity();
+    info._level = player->getLevel();
+    info._class = player->getClass();
+    info._race = player->getRace();
+    info._zoneid = player->IsSpectator() ? 4395 /*Dalaran*/ : player->GetZoneId();
+    info._gender = player->getGender();
+    info._visible = player->IsVisible();
+
+    _slots[guid] = slot;
+    LinkEntry(slot);
+}
+
+void WhoListCacheMgr::Remove(ObjectGuid guid)
+{
+    auto itr = _slots.find(guid);
+    if (itr == _slots.end())
+        return;
+
+    UnlinkEntry(itr->second);
+    _freeSlots.push_back(itr->second);
+    _slots.erase(itr);
+}
+
+WhoListIndex WhoListCacheMgr::SelectIndex(WhoListQuery const& query) const
+{
+    std::array<std::size_t, MAX_WHO_LIST_INDEX> sizes{};
+
+    for (uint32 level = query.LevelMin; level <= query.LevelMax && level < _levelBuckets.size(); ++level)
+        sizes[WHO_LIST_INDEX_LEVEL] += _levelBuckets[level].size();
+
+    for (uint8 classId = 0; classId < MAX_CLASSES; ++classId)
+        if (query.ClassMask & (1 << classId))
+            sizes[WHO_LIST_INDEX_CLASS] += _classBuckets[classId].size();
+
+    for (uint8 race = 0; race < MAX_RACES; ++race)
+        if (query.RaceMask & (1 << race))
+            sizes[WHO_LIST_INDEX_RACE] += _raceBuckets[race].size();
+
+    if (!query.ZonesCount)
+        sizes[WHO_LIST_INDEX_ZONE] = std::numeric_limits<std::size_t>::max();
+    else
+    {
+        for (uint32 i = 0; i < query.ZonesCount; ++i)
+        {
+            auto itr = _zoneBuckets.find(query.Zones[i]);
+            if (itr != _zoneBuckets.end())
+                sizes[WHO_LIST_INDEX_ZONE] += itr->second.size();
+        }
+    }
+
+    return WhoListIndex(std::min_element(sizes.begin(), sizes.end()) - sizes.begin());
+}
+
+WhoListCacheMgr::Bucket& WhoListCacheMgr::GetBucket(WhoListIndex index, WhoListPlayerInfo const& info)
+{
+    switch (index)
+    {
+        case WHO_LIST_INDEX_LEVEL:
+            return _levelBuckets[info._level];
+        case WHO_LIST_INDEX_CLASS:
+            return _classBuckets[info._class];
+        case WHO_LIST_INDEX_RACE:
+            return _raceBuckets[info._race];
+        default:
+            return _zoneBuckets[info._zoneid];
+    }
+}
+
+void WhoListCacheMgr::LinkEntry(uint32 slot)
+{
+    WhoListPlayerInfo& info = _entries[slot];
+
+    for (uint8 i = 0; i < MAX_WHO_LIST_INDEX; ++i)
+    {
+        Bucket& bucket = GetBucket(WhoListIndex(i), info);
+        info._bucketPos[i] = bucket.size();
+        bucket.push_back(slot);
+    }
+}
+
+void WhoListCacheMgr::UnlinkEntry(uint32 slot)
+{
+    WhoListPlayerInfo const& info = _entries[slot];
+
+    for (uint8 i = 0; i < MAX_WHO_LIST_INDEX; ++i)
+    {
+        Bucket& bucket = GetBucket(WhoListIndex(i), info);
 
-        _whoListStorage.emplace_back(player->GetGUID(), player->GetTeamId(), player->GetSession()->GetSecurity(), player->getLevel(),
-            player->getClass(), player->getRace(),
-            (player->IsSpectator() ? 4395 /*Dalaran*/ : player->GetZoneId()), player->getGender(), player->IsVisible(),
-            widePlayerName, wideGuildName, playerName, guildName);
+        // move the last entry of the bucket into the freed position
+        uint32 pos = info._bucketPos[i];
+        uint32 last = bucket.back();
+        bucket[pos] = last;
+        _entries[last]._bucketPos[i] = pos;
+        bucket.pop_back();
     }
 }
@@ -21,26 +21,28 @@
 #include "Common.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <unordered_map>
+
+class Player;
+
+enum WhoListIndex : uint8
+{
+    WHO_LIST_INDEX_LEVEL,
+    WHO_LIST_INDEX_CLASS,
+    WHO_LIST_INDEX_RACE,
+    WHO_LIST_INDEX_ZONE,
+
+    MAX_WHO_LIST_INDEX
+};
 
 class WhoListPlayerInfo
 {
-public:
-    WhoListPlayerInfo(ObjectGuid guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, std::wstring const& widePlayerName,
-        std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName) :
-        _guid(guid),
-        _team(team),
-        _security(security),
-        _level(level),
-        _class(clss),
-        _race(race),
-        _zoneid(zoneid),
-        _gender(gender),
-        _visible(visible),
-        _widePlayerName(widePlayerName),
-        _wideGuildName(wideGuildName),
-        _playerName(playerName),
-        _guildName(guildName) { }
+    friend class WhoListCacheMgr;
 
+public:
     ObjectGuid GetGuid() const { return _guid; }
     TeamId GetTeamId() const { return _team; }
     AccountTypes GetSecurity() const { return _security; }
@@ -57,22 +59,39 @@ public:
 
 private:
     ObjectGuid _guid;
-    TeamId _team;
-    AccountTypes _security;
-    uint8 _level;
-    uint8 _class;
-    uint8 _race;
-    uint32 _zoneid;
-    uint8 _gender;
-    bool _visible;
+    TeamId _team{ TEAM_NEUTRAL };
+    AccountTypes _security{ SEC_PLAYER };
+    uint8 _level{ 0 };
+    uint8 _class{ 0 };
+    uint8 _race{ 0 };
+    uint32 _zoneid{ 0 };
+    uint8 _gender{ 0 };
+    bool _visible{ false };
     std::wstring _widePlayerName;
     std::wstring _wideGuildName;
     std::string _playerName;
     std::string _guildName;
+
+    // position of the entry in each of its buckets, for O(1) removal
+    std::array<uint32, MAX_WHO_LIST_INDEX> _bucketPos{};
 };
 
-using WhoListInfoVector = std::vector<WhoListPlayerInfo>;
+// Numeric part of a who request, matched by the cache itself
+struct WhoListQuery
+{
+    uint32 LevelMin{ 0 };
+    uint32 LevelMax{ 0 };
+    uint32 RaceMask{ 0 };
+    uint32 ClassMask{ 0 };
+    std::array<uint32, 10> Zones{};                         // 10 is client limit
+    uint32 ZonesCount{ 0 };
+
+    bool Matches(WhoListPlayerInfo const& info) const;
+};
 
+// Who list of the online players, kept up to date from player events instead of being rebuilt.
+// Changes are queued from any thread and applied by Update() in the world thread, while no map is updated,
+// so who requests handled in map threads only ever read it.
 class WH_GAME_API WhoListCacheMgr
 {
     WhoListCacheMgr() = default;
@@ -83,14 +102,84 @@ class WH_GAME_API WhoListCacheMgr
 
     WhoListCacheMgr& operator= (WhoListCacheMgr const&) = delete;
     WhoListCacheMgr& operator= (WhoListCacheMgr&&) = delete;
+
+    using Bucket = std::vector<uint32>;
+
 public:
     static WhoListCacheMgr* instance();
 
+    // Player entered or left the world, or changed a field shown or filtered by the who list
+    void QueueUpdate(ObjectGuid guid);
+
+    // Applies the queued changes
     void Update();
-    WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
 
-protected:
-    WhoListInfoVector _whoListStorage;
+    // Calls visitor for every entry matching the numeric part of the query.
+    // Walks the smallest of the level, class, race and zone buckets the query selects.
+    template<typename Visitor>
+    void VisitMatches(WhoListQuery const& query, Visitor&& visitor) const
+    {
+        auto visit = [&](Bucket const& bucket)
+        {
+            for (uint32 slot : bucket)
+                if (query.Matches(_entries[slot]))
+                    visitor(_entries[slot]);
+        };
+
+        switch (SelectIndex(query))
+        {
+            case WHO_LIST_INDEX_LEVEL:
+                for (uint32 level = query.LevelMin; level <= query.LevelMax && level < _levelBuckets.size(); ++level)
+                    visit(_levelBuckets[level]);
+                break;
+            case WHO_LIST_INDEX_CLASS:
+                for (uint8 classId = 0; classId < MAX_CLASSES; ++classId)
+                    if (query.ClassMask & (1 << classId))
+                        visit(_classBuckets[classId]);
+                break;
+            case WHO_LIST_INDEX_RACE:
+                for (uint8 race = 0; race < MAX_RACES; ++race)
+                    if (query.RaceMask & (1 << race))
+                        visit(_raceBuckets[race]);
+                break;
+            case WHO_LIST_INDEX_ZONE:
+                for (uint32 i = 0; i < query.ZonesCount; ++i)
+                {
+                    // the client may repeat a zone
+                    if (std::find(query.Zones.begin(), query.Zones.begin() + i, query.Zones[i]) != query.Zones.begin() + i)
+                        continue;
+
+                    auto itr = _zoneBuckets.find(query.Zones[i]);
+                    if (itr != _zoneBuckets.end())
+                        visit(itr->second);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+private:
+    void Refresh(ObjectGuid guid);
+    void Remove(ObjectGuid guid);
+
+    [[nodiscard]] WhoListIndex SelectIndex(WhoListQuery const& query) const;
+
+    Bucket& GetBucket(WhoListIndex index, WhoListPlayerInfo const& info);
+    void LinkEntry(uint32 slot);
+    void UnlinkEntry(uint32 slot);
+
+    std::vector<WhoListPlayerInfo> _entries;
+    std::vector<uint32> _freeSlots;
+    std::unordered_map<ObjectGuid, uint32> _slots;
+
+    std::array<Bucket, STRONG_MAX_LEVEL + 1> _levelBuckets;
+    std::array<Bucket, MAX_CLASSES> _classBuckets;
+    std::array<Bucket, MAX_RACES> _raceBuckets;
+    std::unordered_map<uint32, Bucket> _zoneBuckets;
+
+    std::mutex _queueLock;
+    std::vector<ObjectGuid> _queue;
 };
 
 #define sWhoListCacheMgr WhoListCacheMgr::instance()
@@ -25,6 +25,7 @@
 #include "DatabaseEnv.h"
 #include "GameConfig.h"
 #include "GameTime.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Player.h"
@@ -243,12 +244,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
         SendToAll(&data);
     }
 
-    PlayerInfo pinfo;
-    pinfo.player = guid;
-    pinfo.flags = MEMBER_FLAG_NONE;
-    pinfo.plrPtr = player;
-
-    playersStore[guid] = pinfo;
+    AddMember(player);
 
     if (_channelRights.joinMessage.length())
         ChatHandler(player->GetSession()).PSendSysMessage("{}", _channelRights.joinMessage);
@@ -312,7 +308,7 @@ void Channel::LeaveChannel(Player* player, bool send)
 
     bool changeowner = playersStore[guid].IsOwner();
 
-    playersStore.erase(guid);
+    RemoveMember(guid);
     if (_announce && (!AccountMgr::IsGMAccount(player->GetSession()->GetSecurity()) ||
                       !CONF_GET_BOOL("Channel.SilentlyGMJoin")))
     {
@@ -485,7 +481,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
 
     if (isOnChannel)
     {
-        playersStore.erase(victim);
+        RemoveMember(victim);
         bad->LeftChannel(this);
         RemoveWatching(bad);
         LeaveNotify(bad);
@@ -960,18 +956,78 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
     }
 }
 
+void Channel::AddMember(Player* player)
+{
+    PlayerInfo pinfo;
+    pinfo.player = player->GetGUID();
+    pinfo.flags = MEMBER_FLAG_NONE;
+    pinfo.plrPtr = player;
+    pinfo.memberIndex = _members.size();
+
+    playersStore[pinfo.player] = pinfo;
+    _members.push_back({ pinfo.player, player, player->GetSession() });
+}
+
+void Channel::RemoveMember(ObjectGuid guid)
+{
+    PlayerContainer::iterator itr = playersStore.find(guid);
+    if (itr == playersStore.end())
+        return;
+
+    // move the last member into the freed position
+    uint32 index = itr->second.memberIndex;
+    if (index < _members.size() && _members[index].Guid == guid)
+    {
+        if (index + 1 < _members.size())
+        {
+            _members[index] = _members.back();
+            playersStore[_members[index].Guid].memberIndex = index;
+        }
+
+        _members.pop_back();
+    }
+
+    playersStore.erase(itr);
+}
+
+char const* Channel::GetMetricType() const
+{
+    if (HasFlag(CHANNEL_FLAG_CUSTOM))
+        return "custom";
+
+    if (HasFlag(CHANNEL_FLAG_LFG))
+        return "lfg";
+
+    if (HasFlag(CHANNEL_FLAG_TRADE))
+        return "trade";
+
+    if (HasFlag(CHANNEL_FLAG_CITY))
+        return "city";
+
+    return "general";
+}
+
+// The packet is copied once into a buffer shared by all receiving sockets
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->GetSession()->SendPacket(data);
+    METRIC_TIMER("channel_broadcast_time", METRIC_TAG("channel_type", GetMetricType()));
+
+    std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(*data);
+
+    for (Member const& member : _members)
+        if (!guid || !member.PlayerPtr->GetSocial()->HasIgnore(guid))
+            member.Session->SendPacket(packet);
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (i->first != who)
-            i->second.plrPtr->GetSession()->SendPacket(data);
+    METRIC_TIMER("channel_broadcast_time", METRIC_TAG("channel_type", GetMetricType()));
+
+    std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(*data);
+
+    for (Member const& member : _members)
+        if (member.Guid != who)
+            member.Session->SendPacket(packet);
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
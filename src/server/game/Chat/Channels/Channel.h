@@ -20,11 +20,14 @@
 
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
+#include <limits>
 #include <string>
 #include <utility>
+#include <vector>
 
 class Player;
 class WorldPacket;
+class WorldSession;
 
 // EnumUtils: DESCRIBE THIS
 enum ChatNotify : uint8
@@ -147,6 +150,7 @@ class WH_GAME_API Channel
         ObjectGuid player;
         uint8 flags;
         Player* plrPtr; // pussywizard
+        uint32 memberIndex = std::numeric_limits<uint32>::max(); // position in _members
 
         [[nodiscard]] bool HasFlag(uint8 flag) const { return flags & flag; }
         void SetFlag(uint8 flag) { if (!HasFlag(flag)) flags |= flag; }
@@ -264,10 +268,16 @@ private:
 
     void SendToAll(WorldPacket* data, ObjectGuid guid = ObjectGuid::Empty);
     void SendToAllButOne(WorldPacket* data, ObjectGuid who);
+
+    // Channel kind for metric tags, unlike the name it has a fixed set of values
+    [[nodiscard]] char const* GetMetricType() const;
     void SendToOne(WorldPacket* data, ObjectGuid who);
     void SendToAllWatching(WorldPacket* data);
 
     [[nodiscard]] bool IsOn(ObjectGuid who) const { return playersStore.find(who) != playersStore.end(); }
+
+    void AddMember(Player* player);
+    void RemoveMember(ObjectGuid guid);
     [[nodiscard]] bool IsBanned(ObjectGuid guid) const;
 
     void UpdateChannelInDB() const;
@@ -288,6 +298,14 @@ private:
     typedef std::unordered_map<ObjectGuid, uint32> BannedContainer;
     typedef std::unordered_set<Player*> PlayersWatchingContainer;
 
+    // members in a dense array for broadcasts, the session is resolved once on join and dropped on leave (and so on logout)
+    struct Member
+    {
+        ObjectGuid Guid;
+        Player* PlayerPtr;
+        WorldSession* Session;
+    };
+
     bool _announce;
     bool _moderation;
     bool _ownership;
@@ -302,6 +320,7 @@ private:
     std::string _password;
     ChannelRights _channelRights;
     PlayerContainer playersStore;
+    std::vector<Member> _members;
     BannedContainer bannedStore;
     PlayersWatchingContainer playersWatchingStore;
 };
@@ -257,6 +257,28 @@ void ThreatContainer::clearReferences()
     }
 
     iThreatList.clear();
+    iRefsByGuid.clear();
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* hostileRef)
+{
+    auto ref = iThreatList.insert(iThreatList.end(), hostileRef);
+    iRefsByGuid.emplace(hostileRef->getUnitGuid(), ref);
+}
+
+void ThreatContainer::remove(HostileReference* hostileRef)
+{
+    auto itr = iRefsByGuid.find(hostileRef->getUnitGuid());
+    if (itr != iRefsByGuid.end() && *itr->second == hostileRef)
+    {
+        iThreatList.erase(itr->second);
+        iRefsByGuid.erase(itr);
+        return;
+    }
+
+    iThreatList.remove(hostileRef);
 }
 
 //============================================================
@@ -271,16 +293,8 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit const* victim) cons
 
 HostileReference* ThreatContainer::getReferenceByTarget(ObjectGuid const& guid) const
 {
-    for (ThreatContainer::StorageType::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-    {
-        HostileReference* ref = (*i);
-        if (ref && ref->getUnitGuid() == guid)
-        {
-            return ref;
-        }
-    }
-
-    return nullptr;
+    auto itr = iRefsByGuid.find(guid);
+    return itr != iRefsByGuid.end() ? *itr->second : nullptr;
 }
 
 //============================================================
@@ -307,7 +321,8 @@ void ThreatContainer::ModifyThreatByPercent(Unit* victim, int32 percent)
 
 void ThreatContainer::update()
 {
-    if (iDirty && iThreatList.size() > 1)
+    // threat changes are flagged conservatively, most of the time the order still holds
+    if (iDirty && iThreatList.size() > 1 && !std::is_sorted(iThreatList.begin(), iThreatList.end(), Warhead::ThreatOrderPred()))
         iThreatList.sort(Warhead::ThreatOrderPred());
 
     iDirty = false;
@@ -413,7 +428,7 @@ HostileReference* ThreatContainer::SelectNextVictim(Creature* attacker, HostileR
 //=================== ThreatMgr ==========================
 //============================================================
 
-ThreatMgr::ThreatMgr(Unit* owner) : iCurrentVictim(nullptr), iOwner(owner), iUpdateTimer(THREAT_UPDATE_INTERVAL)
+ThreatMgr::ThreatMgr(Unit* owner) : iCurrentVictim(nullptr), iOwner(owner), iUpdateTimer(THREAT_UPDATE_INTERVAL), iUnchangedUpdates(0), iClientUpdateNeeded(false)
 {
 }
 
@@ -432,6 +447,8 @@ void ThreatMgr::clearReferences()
     iThreatOfflineContainer.clearReferences();
     iCurrentVictim = nullptr;
     iUpdateTimer = THREAT_UPDATE_INTERVAL;
+    iUnchangedUpdates = 0;
+    iClientUpdateNeeded = false;
 }
 
 //============================================================
@@ -572,6 +589,7 @@ void ThreatMgr::setCurrentVictim(HostileReference* pHostileReference)
 void ThreatMgr::processThreatEvent(ThreatRefStatusChangeEvent* threatRefStatusChangeEvent)
 {
     threatRefStatusChangeEvent->setThreatMgr(this);     // now we can set the threat manager
+    iClientUpdateNeeded = true;
 
     HostileReference* hostileRef = threatRefStatusChangeEvent->getReference();
 
@@ -628,6 +646,13 @@ bool ThreatMgr::isNeedUpdateToClient(uint32 time)
     if (time >= iUpdateTimer)
     {
         iUpdateTimer = THREAT_UPDATE_INTERVAL;
+
+        // the client gets the whole list every time, skip it if nothing changed since the last one
+        if (!iClientUpdateNeeded && ++iUnchangedUpdates < THREAT_FULL_UPDATE_INTERVALS)
+            return false;
+
+        iUnchangedUpdates = 0;
+        iClientUpdateNeeded = false;
         return true;
     }
     iUpdateTimer -= time;
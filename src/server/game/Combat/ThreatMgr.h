@@ -24,6 +24,7 @@
 #include "SharedDefines.h"
 #include "UnitEvents.h"
 #include <list>
+#include <unordered_map>
 
 //==============================================================
 
@@ -33,6 +34,7 @@ class ThreatMgr;
 class SpellInfo;
 
 #define THREAT_UPDATE_INTERVAL (2 * IN_MILLISECONDS)    // Server should send threat update to client periodically each second
+#define THREAT_FULL_UPDATE_INTERVALS 5                  // Unchanged threat lists are still resent every this many intervals, for new observers
 
 //==============================================================
 // Class to calculate the real threat based
@@ -176,15 +178,8 @@ public:
     [[nodiscard]] StorageType const& GetThreatList() const { return iThreatList; }
 
 private:
-    void remove(HostileReference* hostileRef)
-    {
-        iThreatList.remove(hostileRef);
-    }
-
-    void addReference(HostileReference* hostileRef)
-    {
-        iThreatList.push_back(hostileRef);
-    }
+    void remove(HostileReference* hostileRef);
+    void addReference(HostileReference* hostileRef);
 
     void clearReferences();
 
@@ -192,6 +187,7 @@ private:
     void update();
 
     StorageType iThreatList;
+    std::unordered_map<ObjectGuid, StorageType::iterator> iRefsByGuid; // O(1) lookup of the references, world bosses can have hundreds
     bool iDirty{false};
 };
 
@@ -283,6 +279,8 @@ private:
     HostileReference* iCurrentVictim;
     Unit* iOwner;
     uint32 iUpdateTimer;
+    uint32 iUnchangedUpdates;
+    bool iClientUpdateNeeded;
     ThreatContainer iThreatContainer;
     ThreatContainer iThreatOfflineContainer;
 };
@@ -23,7 +23,9 @@
 #include "DBCacheMgr.h"
 #include "DatabaseEnv.h"
 #include "Errors.h"
+#include "GameConfig.h"
 #include "GameEventMgr.h"
+#include "GameTime.h"
 #include "InstanceScript.h"
 #include "ObjectMgr.h"
 #include "Pet.h"
@@ -36,6 +38,115 @@
 #include "SpellMgr.h"
 #include "StopWatch.h"
 
+namespace
+{
+    // Rough evaluation cost of a condition, used to run cheap checks of an else group first
+    uint8 GetConditionCost(Condition const* cond)
+    {
+        if (cond->ReferenceId)
+            return 3;
+
+        switch (cond->ConditionType)
+        {
+            // plain field reads
+            case CONDITION_NONE:
+            case CONDITION_ZONEID:
+            case CONDITION_AREAID:
+            case CONDITION_MAPID:
+            case CONDITION_TEAM:
+            case CONDITION_CLASS:
+            case CONDITION_RACE:
+            case CONDITION_GENDER:
+            case CONDITION_LEVEL:
+            case CONDITION_DRUNKENSTATE:
+            case CONDITION_SPAWNMASK:
+            case CONDITION_PHASEMASK:
+            case CONDITION_TYPE_MASK:
+            case CONDITION_OBJECT_ENTRY_GUID:
+            case CONDITION_UNIT_STATE:
+            case CONDITION_CREATURE_TYPE:
+            case CONDITION_ALIVE:
+            case CONDITION_HP_VAL:
+            case CONDITION_HP_PCT:
+            case CONDITION_STAND_STATE:
+            case CONDITION_CHARMED:
+            case CONDITION_TAXI:
+            case CONDITION_DIFFICULTY_ID:
+            case CONDITION_TITLE:
+                return 0;
+            // inventory scans and grid searches
+            case CONDITION_ITEM:
+            case CONDITION_NEAR_CREATURE:
+            case CONDITION_NEAR_GAMEOBJECT:
+            case CONDITION_IN_WATER:
+                return 2;
+            default:
+                return 1;
+        }
+    }
+
+    // Conditions that only read the state of the player itself, not of its surroundings
+    bool IsPlayerOnlyCondition(Condition const* cond)
+    {
+        if (cond->ReferenceId || cond->ConditionTarget)
+            return false;
+
+        switch (cond->ConditionType)
+        {
+            case CONDITION_NONE:
+            case CONDITION_ITEM:
+            case CONDITION_ITEM_EQUIPPED:
+            case CONDITION_REPUTATION_RANK:
+            case CONDITION_ACHIEVEMENT:
+            case CONDITION_TEAM:
+            case CONDITION_CLASS:
+            case CONDITION_RACE:
+            case CONDITION_GENDER:
+            case CONDITION_SKILL:
+            case CONDITION_QUESTREWARDED:
+            case CONDITION_QUESTTAKEN:
+            case CONDITION_QUEST_COMPLETE:
+            case CONDITION_QUEST_NONE:
+            case CONDITION_QUEST_SATISFY_EXCLUSIVE:
+            case CONDITION_QUESTSTATE:
+            case CONDITION_DAILY_QUEST_DONE:
+            case CONDITION_QUEST_OBJECTIVE_PROGRESS:
+            case CONDITION_SPELL:
+            case CONDITION_LEVEL:
+            case CONDITION_TITLE:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    struct PlayerConditionKey
+    {
+        CompiledConditionList const* Compiled;
+        ObjectGuid Player;
+
+        bool operator==(PlayerConditionKey const& right) const = default;
+    };
+
+    struct PlayerConditionKeyHash
+    {
+        std::size_t operator()(PlayerConditionKey const& key) const
+        {
+            return std::hash<CompiledConditionList const*>()(key.Compiled) ^ (std::hash<uint64>()(key.Player.GetRawValue()) << 1);
+        }
+    };
+
+    // Results of player only condition lists, kept per map update thread for the current world tick
+    struct PlayerConditionCache
+    {
+        Milliseconds Tick{ 0 };
+        uint32 LoadGeneration{ 0 };
+        std::unordered_map<PlayerConditionKey, bool, PlayerConditionKeyHash> Results;
+    };
+
+    thread_local PlayerConditionCache PlayerConditionResults;
+}
+
 // Checks if object meets the condition
 // Can have CONDITION_SOURCE_TYPE_NONE && !mReferenceId if called from a special event (ie: eventAI)
 bool Condition::Meets(ConditionSourceInfo& sourceInfo)
@@ -856,8 +967,75 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& co
     return mask;
 }
 
+bool CompiledConditionList::Matches(ConditionList const& conditions) const
+{
+    if (conditions.size() != Source.size())
+        return false;
+
+    return std::equal(Source.begin(), Source.end(), conditions.begin());
+}
+
+bool ConditionMgr::IsObjectMeetToCompiledConditions(ConditionSourceInfo& sourceInfo, CompiledConditionList const& compiled)
+{
+    uint32 step = 0;
+    for (uint32 groupEnd : compiled.GroupEnds)
+    {
+        bool meets = true;
+        for (; step < groupEnd && meets; ++step)
+        {
+            CompiledConditionList::Step const& check = compiled.Steps[step];
+            if (check.Cond->ReferenceId)
+                meets = !check.Reference || IsObjectMeetToCompiledConditions(sourceInfo, *check.Reference);
+            else
+                meets = check.Cond->Meets(sourceInfo);
+        }
+
+        if (meets)
+            return true;
+
+        step = groupEnd;
+    }
+
+    return false;
+}
+
+bool ConditionMgr::IsObjectMeetToCompiledConditionsMemoized(ConditionSourceInfo& sourceInfo, CompiledConditionList const& compiled)
+{
+    Player* player = sourceInfo.mConditionTargets[0] ? sourceInfo.mConditionTargets[0]->ToPlayer() : nullptr;
+    if (!player)
+        return IsObjectMeetToCompiledConditions(sourceInfo, compiled);
+
+    PlayerConditionCache& cache = PlayerConditionResults;
+    if (cache.Tick != GameTime::GetGameTimeMS() || cache.LoadGeneration != _loadGeneration)
+    {
+        cache.Results.clear();
+        cache.Tick = GameTime::GetGameTimeMS();
+        cache.LoadGeneration = _loadGeneration;
+    }
+
+    PlayerConditionKey key{ &compiled, player->GetGUID() };
+    auto itr = cache.Results.find(key);
+    if (itr != cache.Results.end())
+        return itr->second;
+
+    bool meets = IsObjectMeetToCompiledConditions(sourceInfo, compiled);
+    cache.Results.emplace(key, meets);
+    return meets;
+}
+
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
 {
+    if (CompiledConditionList const* compiled = conditions.empty() ? nullptr : conditions.front()->Compiled)
+    {
+        if (compiled->Matches(conditions))
+        {
+            if (compiled->PlayerOnly && _memoizePlayerConditions)
+                return IsObjectMeetToCompiledConditionsMemoized(sourceInfo, *compiled);
+
+            return IsObjectMeetToCompiledConditions(sourceInfo, *compiled);
+        }
+    }
+
     //     groupId, groupCheckPassed
     std::map<uint32, bool> ElseGroupStore;
     for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
@@ -938,20 +1116,29 @@ ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType
     ConditionList spellCond;
     if (sourceType > CONDITION_SOURCE_TYPE_NONE && sourceType < CONDITION_SOURCE_TYPE_MAX)
     {
-        ConditionContainer::const_iterator itr = ConditionStore.find(sourceType);
-        if (itr != ConditionStore.end())
+        ConditionTypeContainer::const_iterator i = ConditionStore[sourceType].find(entry);
+        if (i != ConditionStore[sourceType].end())
         {
-            ConditionTypeContainer::const_iterator i = (*itr).second.find(entry);
-            if (i != (*itr).second.end())
-            {
-                spellCond = (*i).second;
-                LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
-            }
+            spellCond = (*i).second;
+            LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
         }
     }
     return spellCond;
 }
 
+ConditionList const* ConditionMgr::FindConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const
+{
+    if (sourceType <= CONDITION_SOURCE_TYPE_NONE || sourceType >= CONDITION_SOURCE_TYPE_MAX)
+        return nullptr;
+
+    ConditionTypeContainer const& typeContainer = ConditionStore[sourceType];
+    auto itr = typeContainer.find(entry);
+    if (itr == typeContainer.end() || itr->second.empty())
+        return nullptr;
+
+    return &itr->second;
+}
+
 ConditionList ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId)
 {
     ConditionList                                   cond;
@@ -1000,6 +1187,19 @@ ConditionList ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32
     return cond;
 }
 
+ConditionList const* ConditionMgr::FindConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const
+{
+    auto itr = SmartEventConditionStore.find(std::make_pair(entryOrGuid, sourceType));
+    if (itr == SmartEventConditionStore.end())
+        return nullptr;
+
+    auto i = itr->second.find(eventId + 1);
+    if (i == itr->second.end() || i->second.empty())
+        return nullptr;
+
+    return &i->second;
+}
+
 ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
 {
     ConditionList                               cond;
@@ -1028,6 +1228,7 @@ void ConditionMgr::LoadConditions(bool isReload)
     StopWatch sw;
 
     Clean();
+    ++_loadGeneration;
 
     // must clear all custom handled cases (groupped types) before reload
     if (isReload)
@@ -1281,25 +1482,13 @@ void ConditionMgr::LoadConditions(bool isReload)
         }
 
         // handle not grouped conditions
-        // make sure we have a storage list for our SourceType
-        if (ConditionStore.find(cond->SourceType) == ConditionStore.end())
-        {
-            ConditionTypeContainer mTypeMap;
-            ConditionStore[cond->SourceType] = mTypeMap; // add new empty list for SourceType
-        }
-
-        // make sure we have a condition list for our SourceType's entry
-        if (ConditionStore[cond->SourceType].find(cond->SourceEntry) == ConditionStore[cond->SourceType].end())
-        {
-            ConditionList mCondList;
-            ConditionStore[cond->SourceType][cond->SourceEntry] = mCondList;
-        }
-
         // add new Condition to storage based on Type/Entry
         ConditionStore[cond->SourceType][cond->SourceEntry].push_back(cond);
         ++count;
     }
 
+    CompileConditions();
+
     LOG_INFO("server.loading", ">> Loaded {} conditions in {}", count, sw);
     LOG_INFO("server.loading", "");
 }
@@ -2467,18 +2656,16 @@ void ConditionMgr::Clean()
 
     ConditionReferenceStore.clear();
 
-    for (ConditionContainer::iterator itr = ConditionStore.begin(); itr != ConditionStore.end(); ++itr)
+    for (ConditionTypeContainer& typeContainer : ConditionStore)
     {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
+        for (ConditionTypeContainer::iterator it = typeContainer.begin(); it != typeContainer.end(); ++it)
         {
             for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
             it->second.clear();
         }
-        itr->second.clear();
+        typeContainer.clear();
     }
 
-    ConditionStore.clear();
-
     for (CreatureSpellConditionContainer::iterator itr = VehicleSpellConditionStore.begin(); itr != VehicleSpellConditionStore.end(); ++itr)
     {
         for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
@@ -2531,4 +2718,97 @@ void ConditionMgr::Clean()
     for (std::list<Condition*>::const_iterator itr = AllocatedMemoryStore.begin(); itr != AllocatedMemoryStore.end(); ++itr) delete *itr;
 
     AllocatedMemoryStore.clear();
+
+    _compiledConditions.clear();
+}
+
+CompiledConditionList* ConditionMgr::CompileConditionList(ConditionList const& conditions, ConditionSourceType sourceType)
+{
+    if (conditions.empty() || conditions.front()->Compiled)
+        return nullptr;
+
+    auto compiled = std::make_unique<CompiledConditionList>();
+    compiled->Source.assign(conditions.begin(), conditions.end());
+
+    // else groups in order of first appearance, not loaded conditions are ignored like the list walk does
+    std::vector<std::pair<uint32, std::vector<Condition*>>> groups;
+    for (Condition* cond : conditions)
+    {
+        if (!cond->isLoaded())
+            continue;
+
+        auto itr = std::find_if(groups.begin(), groups.end(), [cond](auto const& group) { return group.first == cond->ElseGroup; });
+        if (itr == groups.end())
+            itr = groups.emplace(groups.end(), cond->ElseGroup, std::vector<Condition*>());
+
+        itr->second.push_back(cond);
+    }
+
+    // spell conditions report the last failed condition to the client, keep their order
+    bool reorder = sourceType != CONDITION_SOURCE_TYPE_SPELL;
+    compiled->PlayerOnly = sourceType != CONDITION_SOURCE_TYPE_SPELL && !groups.empty();
+
+    for (auto& [elseGroup, groupConditions] : groups)
+    {
+        if (reorder)
+            std::stable_sort(groupConditions.begin(), groupConditions.end(), [](Condition const* left, Condition const* right) { return GetConditionCost(left) < GetConditionCost(right); });
+
+        for (Condition* cond : groupConditions)
+        {
+            compiled->Steps.push_back({ cond, nullptr });
+            compiled->PlayerOnly = compiled->PlayerOnly && IsPlayerOnlyCondition(cond);
+        }
+
+        compiled->GroupEnds.push_back(compiled->Steps.size());
+    }
+
+    conditions.front()->Compiled = compiled.get();
+    _compiledConditions.push_back(std::move(compiled));
+    return _compiledConditions.back().get();
+}
+
+void ConditionMgr::CompileConditions()
+{
+    _memoizePlayerConditions = CONF_GET_BOOL("Conditions.MemoizePlayerResults");
+
+    // reference templates first, the lists using them point to their programs
+    for (auto const& [refId, conditions] : ConditionReferenceStore)
+        CompileConditionList(conditions, CONDITION_SOURCE_TYPE_NONE);
+
+    for (uint32 sourceType = 0; sourceType < CONDITION_SOURCE_TYPE_MAX; ++sourceType)
+        for (auto const& [entry, conditions] : ConditionStore[sourceType])
+            CompileConditionList(conditions, ConditionSourceType(sourceType));
+
+    for (CreatureSpellConditionContainer const* store : { &VehicleSpellConditionStore, &SpellClickEventConditionStore, &NpcVendorConditionContainerStore })
+        for (auto const& [creatureId, typeContainer] : *store)
+            for (auto const& [entry, conditions] : typeContainer)
+                CompileConditionList(conditions, conditions.front()->SourceType);
+
+    for (auto const& [key, typeContainer] : SmartEventConditionStore)
+        for (auto const& [eventId, conditions] : typeContainer)
+            CompileConditionList(conditions, CONDITION_SOURCE_TYPE_SMART_EVENT);
+
+    // loot, gossip and spell implicit target lists are owned by their templates, rebuild them in load order.
+    // Spell implicit target conditions shared between effects may not match, those lists are walked as before.
+    std::map<std::tuple<uint32, uint32, int32>, ConditionList> ownedLists;
+    for (Condition* cond : AllocatedMemoryStore)
+        ownedLists[std::make_tuple(uint32(cond->SourceType), cond->SourceGroup, cond->SourceEntry)].push_back(cond);
+
+    for (auto const& [key, conditions] : ownedLists)
+        CompileConditionList(conditions, conditions.front()->SourceType);
+
+    for (auto const& compiled : _compiledConditions)
+    {
+        for (CompiledConditionList::Step& step : compiled->Steps)
+        {
+            if (!step.Cond->ReferenceId)
+                continue;
+
+            auto ref = ConditionReferenceStore.find(step.Cond->ReferenceId);
+            if (ref != ConditionReferenceStore.end() && !ref->second.empty())
+                step.Reference = ref->second.front()->Compiled;
+        }
+    }
+
+    LOG_INFO("server.loading", ">> Compiled {} condition lists", _compiledConditions.size());
 }
@@ -19,14 +19,19 @@
 #define WARHEAD_CONDITIONMGR_H
 
 #include "Define.h"
+#include <array>
 #include <list>
 #include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 class Player;
 class Unit;
 class WorldObject;
 class LootTemplate;
 struct Condition;
+struct CompiledConditionList;
 
 enum ConditionTypes
 {
@@ -206,6 +211,7 @@ struct Condition
     uint32                  ScriptId;
     uint8                   ConditionTarget;
     bool                    NegativeCondition;
+    CompiledConditionList const* Compiled;     // set on the first condition of every loaded list
 
     Condition()
     {
@@ -224,6 +230,7 @@ struct Condition
         ErrorTextId        = 0;
         ScriptId           = 0;
         NegativeCondition  = false;
+        Compiled           = nullptr;
     }
 
     bool Meets(ConditionSourceInfo& sourceInfo);
@@ -234,13 +241,31 @@ struct Condition
 
 typedef std::list<Condition*> ConditionList;
 typedef std::map<uint32, ConditionList> ConditionTypeContainer;
-typedef std::map<ConditionSourceType, ConditionTypeContainer> ConditionContainer;
+typedef std::array<ConditionTypeContainer, CONDITION_SOURCE_TYPE_MAX> ConditionContainer;
 typedef std::map<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
 typedef std::map<uint32, ConditionTypeContainer> NpcVendorConditionContainer;
 typedef std::map<std::pair<int32, uint32 /*SAI source_type*/>, ConditionTypeContainer> SmartEventConditionContainer;
 
 typedef std::map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
 
+// Flat form of a loaded ConditionList. Else groups are stored one after another,
+// the checks of a group are ordered cheapest first and stop at the first failure.
+struct CompiledConditionList
+{
+    struct Step
+    {
+        Condition* Cond;
+        CompiledConditionList const* Reference; // compiled reference template, nullptr if not a reference or the template is missing
+    };
+
+    std::vector<Condition*> Source;    // conditions in load order, a list must hold exactly these to use the program
+    std::vector<Step> Steps;
+    std::vector<uint32> GroupEnds;     // one past the last step of every else group
+    bool PlayerOnly{ false };          // result only depends on the player in target 0, can be memoized for a tick
+
+    [[nodiscard]] bool Matches(ConditionList const& conditions) const;
+};
+
 class WH_GAME_API ConditionMgr
 {
 private:
@@ -258,11 +283,17 @@ public:
     bool IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions);
     bool IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionList const& conditions);
     bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    [[nodiscard]] uint32 GetLoadGeneration() const { return _loadGeneration; }
     [[nodiscard]] bool CanHaveSourceGroupSet(ConditionSourceType sourceType) const;
     [[nodiscard]] bool CanHaveSourceIdSet(ConditionSourceType sourceType) const;
     ConditionList GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
+    // Same lookup without the copy, nullptr if the entry has no conditions. Only valid until the next (re)load.
+    [[nodiscard]] ConditionList const* FindConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const;
     ConditionList GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId);
     ConditionList GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType);
+    // Same lookup without the copy, nullptr if the event has no conditions.
+    // Only valid until the next (re)load, compare GetLoadGeneration before reusing it.
+    [[nodiscard]] ConditionList const* FindConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const;
     ConditionList GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
     ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
 
@@ -273,6 +304,11 @@ private:
     bool addToGossipMenuItems(Condition* cond);
     bool addToSpellImplicitTargetConditions(Condition* cond);
     bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    bool IsObjectMeetToCompiledConditions(ConditionSourceInfo& sourceInfo, CompiledConditionList const& compiled);
+    bool IsObjectMeetToCompiledConditionsMemoized(ConditionSourceInfo& sourceInfo, CompiledConditionList const& compiled);
+
+    void CompileConditions();
+    CompiledConditionList* CompileConditionList(ConditionList const& conditions, ConditionSourceType sourceType);
 
     void Clean(); // free up resources
     std::list<Condition*> AllocatedMemoryStore; // some garbage collection :)
@@ -283,6 +319,11 @@ private:
     CreatureSpellConditionContainer   SpellClickEventConditionStore;
     NpcVendorConditionContainer       NpcVendorConditionContainerStore;
     SmartEventConditionContainer      SmartEventConditionStore;
+
+    std::vector<std::unique_ptr<CompiledConditionList>> _compiledConditions;
+    bool _memoizePlayerConditions{ false };
+
+    uint32 _loadGeneration{ 0 }; // increased on every (re)load, invalidates cached ConditionList pointers
 };
 
 #define sConditionMgr ConditionMgr::instance()
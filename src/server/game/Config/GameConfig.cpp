@@ -40,6 +40,9 @@ void GameConfig::Load(bool reload)
     LOG_INFO("server.loading", "{} game configuraton:", reload ? "Reloading" : "Loading");
 
     LoadConfigs(reload);
+
+    // typed values must see the new options before they are checked
+    RefreshTypedOptions();
     CheckOptions(reload);
 
     LOG_INFO("server.loading", "");
@@ -85,23 +88,18 @@ void GameConfig::AddOption(std::initializer_list<std::string> const& optionList)
 template<Warhead::Types::ConfigValue T>
 T GameConfig::GetOption(std::string_view optionName, Optional<T> def /*= std::nullopt*/)
 {
-    // copy from string_view
-    std::string option{ optionName };
-
     // Check exist option part 1
-    auto itr = _configOptions.find(option);
+    auto itr = _configOptions.find(optionName);
     if (itr == _configOptions.end())
     {
         AddOption(optionName, def);
-        itr = _configOptions.find(option);
+        itr = _configOptions.find(optionName);
     }
 
-    std::string defStr = Warhead::Config::GetDefaultValueString(def);
-
     // Check exist option part 2
     if (itr == _configOptions.end())
     {
-        LOG_FATAL("server.loading", "> GameConfig::GetOption: option ({}) is not exists. Returned ({})", optionName, defStr);
+        LOG_FATAL("server.loading", "> GameConfig::GetOption: option ({}) is not exists. Returned ({})", optionName, Warhead::Config::GetDefaultValueString(def));
         return Warhead::Config::GetDefaultValue<T>();
     }
 
@@ -114,13 +112,41 @@ T GameConfig::GetOption(std::string_view optionName, Optional<T> def /*= std::nu
 
     if (!result)
     {
-        LOG_ERROR("server.loading", "> GameConfig::GetOption: Bad value defined for '{}', use '{}' instead", optionName, defStr);
+        LOG_ERROR("server.loading", "> GameConfig::GetOption: Bad value defined for '{}', use '{}' instead", optionName, Warhead::Config::GetDefaultValueString(def));
         return Warhead::Config::GetDefaultValue<T>();
     }
 
     return *result;
 }
 
+template<Warhead::Types::ConfigValue T>
+GameConfigValue<T> const* GameConfig::GetTypedOption(std::string_view optionName)
+{
+    std::lock_guard<std::mutex> guard(_typedOptionsMutex);
+
+    auto key = std::make_pair(std::string(optionName), std::type_index(typeid(T)));
+    auto itr = _typedOptionsByName.find(key);
+    if (itr != _typedOptionsByName.end())
+        return static_cast<GameConfigValue<T> const*>(itr->second);
+
+    auto value = std::make_unique<GameConfigValue<T>>(optionName);
+    value->Refresh();
+
+    GameConfigValue<T> const* result = value.get();
+    _typedOptionsByName.emplace(std::move(key), value.get());
+    _typedOptions.push_back(std::move(value));
+    return result;
+}
+
+void GameConfig::RefreshTypedOptions(std::string_view optionName /*= {}*/)
+{
+    std::lock_guard<std::mutex> guard(_typedOptionsMutex);
+
+    for (auto const& value : _typedOptions)
+        if (optionName.empty() || value->GetOptionName() == optionName)
+            value->Refresh();
+}
+
 // Set option
 template<Warhead::Types::ConfigValue T>
 void GameConfig::SetOption(std::string_view optionName, T value)
@@ -150,6 +176,9 @@ void GameConfig::SetOption(std::string_view optionName, T value)
 
     _configOptions.erase(option);
     _configOptions.emplace(option, valueStr);
+    cacheLock.unlock();
+
+    RefreshTypedOptions(optionName);
 }
 
 // Loading
@@ -205,7 +234,7 @@ void GameConfig::CheckOptions(bool reload /*= false*/)
     ///- Read all rates from the config file
     auto CheckRate = [this](std::string const& optionName)
     {
-        auto _rate = CONF_GET_FLOAT(optionName);
+        auto _rate = sGameConfig->GetOption<float>(optionName);
 
         if (_rate < 0.0f)
         {
@@ -263,7 +292,7 @@ void GameConfig::CheckOptions(bool reload /*= false*/)
 
     auto CheckDurabilityLossChance = [this](std::string const& optionName)
     {
-        float option = CONF_GET_FLOAT(optionName);
+        float option = sGameConfig->GetOption<float>(optionName);
         if (option < 0.0f)
         {
             LOG_ERROR("server.loading", "{} ({}) must be >= 0. Using 0.0 instead", optionName, option);
@@ -303,7 +332,7 @@ void GameConfig::CheckOptions(bool reload /*= false*/)
 
     auto CheckMinName = [this](std::string const& optionName, int32 const& maxNameSymols)
     {
-        int32 confSymbols = CONF_GET_INT(optionName);
+        int32 confSymbols = sGameConfig->GetOption<int32>(optionName);
         if (confSymbols < 1 || confSymbols > maxNameSymols)
         {
             LOG_ERROR("server.loading", "{} ({}) must be in range 1..{}. Set to 2.", optionName, confSymbols, maxNameSymols);
@@ -389,14 +418,14 @@ void GameConfig::CheckOptions(bool reload /*= false*/)
 
     auto CheckPoints = [this](std::string const& startPointsOptionName, std::string const& maxPointsOptionName)
     {
-        int32 maxPoints = CONF_GET_INT(maxPointsOptionName);
+        int32 maxPoints = sGameConfig->GetOption<int32>(maxPointsOptionName);
         if (maxPoints < 0)
         {
             LOG_ERROR("server.loading", "{} ({}) can't be negative. Set to 0.", maxPointsOptionName, maxPoints);
             SetOption<int32>(maxPointsOptionName, 0);
         }
 
-        int32 startPoints = CONF_GET_INT(startPointsOptionName);
+        int32 startPoints = sGameConfig->GetOption<int32>(startPointsOptionName);
         if (startPoints < 0)
         {
             LOG_ERROR("server.loading", "{} ({}) must be in range 0..{}({}). Set to {}.", startPointsOptionName, startPoints, maxPointsOptionName, maxPoints, 0);
@@ -478,7 +507,7 @@ void GameConfig::CheckOptions(bool reload /*= false*/)
 
     auto CheckResetTime = [this](std::string const& optionName)
     {
-        int32 hours = CONF_GET_INT(optionName);
+        int32 hours = sGameConfig->GetOption<int32>(optionName);
         if (hours > 23)
         {
             LOG_ERROR("server.loading", "{} ({}) can't be load. Set to 6.", optionName, hours);
@@ -506,7 +535,7 @@ void GameConfig::CheckOptions(bool reload /*= false*/)
 
     auto CheckBuffBG = [this](std::string const& optionName, uint32 defaultTime)
     {
-        uint32 time = CONF_GET_INT(optionName);
+        uint32 time = sGameConfig->GetOption<int32>(optionName);
         if (time < 1)
         {
             LOG_ERROR("server.loading", "{} ({}) must be > 0. Using {} instead.", optionName, defaultTime);
@@ -535,7 +564,7 @@ void GameConfig::CheckOptions(bool reload /*= false*/)
 
     auto CheckLogRecordsCount = [this](std::string const& optionName, int32 const& maxRecords)
     {
-        int32 records = CONF_GET_INT(optionName);
+        int32 records = sGameConfig->GetOption<int32>(optionName);
         if (records > maxRecords)
             SetOption<int32>(optionName, maxRecords);
     };
@@ -575,3 +604,19 @@ TEMPLATE_GAME_CONFIG_OPTION(float)
 TEMPLATE_GAME_CONFIG_OPTION(std::string)
 
 #undef TEMPLATE_GAME_CONFIG_OPTION
+
+#define TEMPLATE_GAME_CONFIG_TYPED_OPTION(__typename) \
+    template WH_GAME_API GameConfigValue<__typename> const* GameConfig::GetTypedOption(std::string_view optionName);
+
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(bool)
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(uint8)
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(int8)
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(uint16)
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(int16)
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(uint32)
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(int32)
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(uint64)
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(int64)
+TEMPLATE_GAME_CONFIG_TYPED_OPTION(float)
+
+#undef TEMPLATE_GAME_CONFIG_TYPED_OPTION
@@ -21,8 +21,43 @@
 #include "Define.h"
 #include "Optional.h"
 #include "Types.h"
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <typeindex>
 #include <unordered_map>
+#include <vector>
+
+// Parsed value of one option, refreshed on every (re)load and SetOption
+class WH_GAME_API GameConfigValueBase
+{
+public:
+    explicit GameConfigValueBase(std::string_view optionName) : _optionName(optionName) { }
+    virtual ~GameConfigValueBase() = default;
+
+    virtual void Refresh() = 0;
+    [[nodiscard]] std::string const& GetOptionName() const { return _optionName; }
+
+protected:
+    std::string _optionName;
+};
+
+template<Warhead::Types::ConfigValue T>
+class GameConfigValue : public GameConfigValueBase
+{
+    static_assert(std::is_arithmetic_v<T>, "only arithmetic options can be read atomically");
+
+public:
+    explicit GameConfigValue(std::string_view optionName) : GameConfigValueBase(optionName) { }
+
+    void Refresh() override;
+    [[nodiscard]] T Get() const { return _value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<T> _value{};
+};
 
 class WH_GAME_API GameConfig
 {
@@ -58,19 +93,57 @@ public:
     template<Warhead::Types::ConfigValue T>
     void SetOption(std::string_view optionName, T value);
 
+    // Typed value of the option, parsed once and kept up to date. The pointer stays valid until shutdown.
+    template<Warhead::Types::ConfigValue T>
+    GameConfigValue<T> const* GetTypedOption(std::string_view optionName);
+
 private:
     void LoadConfigs(bool reload = false);
+    void RefreshTypedOptions(std::string_view optionName = {});
 
-    std::unordered_map<std::string /*name*/, std::string /*value*/> _configOptions;
+    struct OptionNameHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view name) const { return std::hash<std::string_view>()(name); }
+    };
+
+    std::unordered_map<std::string /*name*/, std::string /*value*/, OptionNameHash, std::equal_to<>> _configOptions;
     std::shared_mutex _mutex;
+
+    std::vector<std::unique_ptr<GameConfigValueBase>> _typedOptions;
+    std::map<std::pair<std::string, std::type_index>, GameConfigValueBase*> _typedOptionsByName;
+    std::mutex _typedOptionsMutex;
 };
 
 #define sGameConfig GameConfig::instance()
 
-#define CONF_GET_BOOL(__optionName) sGameConfig->GetOption<bool>(__optionName)
+template<Warhead::Types::ConfigValue T>
+void GameConfigValue<T>::Refresh()
+{
+    _value.store(sGameConfig->GetOption<T>(_optionName), std::memory_order_relaxed);
+}
+
+// Handle to an option for code that reads it often, the lookup is done once on construction
+template<Warhead::Types::ConfigValue T>
+class GameConfigOption
+{
+public:
+    explicit GameConfigOption(std::string_view optionName) : _value(sGameConfig->GetTypedOption<T>(optionName)) { }
+
+    [[nodiscard]] T Get() const { return _value->Get(); }
+
+private:
+    GameConfigValue<T> const* _value;
+};
+
+// Every call site keeps its own handle, so the option name must be a constant.
+// Use sGameConfig->GetOption<T>() for names built at runtime.
+#define CONF_GET_CACHED(__type, __optionName) ([]() -> __type { static GameConfigOption<__type> const _option(__optionName); return _option.Get(); }())
+
+#define CONF_GET_BOOL(__optionName) CONF_GET_CACHED(bool, __optionName)
 #define CONF_GET_STR(__optionName) sGameConfig->GetOption<std::string>(__optionName)
-#define CONF_GET_INT(__optionName) sGameConfig->GetOption<int32>(__optionName)
-#define CONF_GET_UINT(__optionName) sGameConfig->GetOption<uint32>(__optionName)
-#define CONF_GET_FLOAT(__optionName) sGameConfig->GetOption<float>(__optionName)
+#define CONF_GET_INT(__optionName) CONF_GET_CACHED(int32, __optionName)
+#define CONF_GET_UINT(__optionName) CONF_GET_CACHED(uint32, __optionName)
+#define CONF_GET_FLOAT(__optionName) CONF_GET_CACHED(float, __optionName)
 
 #endif // __GAME_CONFIG
@@ -2719,10 +2719,14 @@ namespace lfg
         m_options = options;
     }
 
-    LfgUpdateData LFGMgr::GetLfgStatus(ObjectGuid guid)
+    LfgUpdateData LFGMgr::GetLfgStatus(ObjectGuid guid) const
     {
-        LfgPlayerData& playerData = PlayersStore[guid];
-        return LfgUpdateData(LFG_UPDATETYPE_UPDATE_STATUS, playerData.GetState(), playerData.GetSelectedDungeons());
+        // lookup only, the status is requested in the parallel phase of the session update
+        auto itr = PlayersStore.find(guid);
+        if (itr == PlayersStore.end())
+            return LfgUpdateData(LFG_UPDATETYPE_UPDATE_STATUS, LFG_STATE_NONE, LfgDungeonSet());
+
+        return LfgUpdateData(LFG_UPDATETYPE_UPDATE_STATUS, itr->second.GetState(), itr->second.GetSelectedDungeons());
     }
 
     bool LFGMgr::IsSeasonActive(uint32 dungeonId)
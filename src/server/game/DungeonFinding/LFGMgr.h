@@ -515,7 +515,7 @@ namespace lfg
         /// Get locked dungeons
         LfgLockMap const& GetLockedDungeons(ObjectGuid guid);
         /// Returns current lfg status
-        LfgUpdateData GetLfgStatus(ObjectGuid guid);
+        LfgUpdateData GetLfgStatus(ObjectGuid guid) const;
         /// Checks if Seasonal dungeon is active
         bool IsSeasonActive(uint32 dungeonId);
         /// Gets the random dungeon reward corresponding to given dungeon and player level
@@ -1332,19 +1332,9 @@ bool WorldObject::IsWithinLOS(float ox, float oy, float oz, VMAP::ModelIgnoreFla
 {
     if (IsInWorld())
     {
-        oz += GetCollisionHeight();
-        float x, y, z;
-        if (GetTypeId() == TYPEID_PLAYER)
-        {
-            GetPosition(x, y, z);
-            z += GetCollisionHeight();
-        }
-        else
-        {
-            GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
-        }
-
-        return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+        Position from, to;
+        GetLineOfSightPoints(ox, oy, oz, from, to);
+        return GetMap()->isInLineOfSight(from.GetPositionX(), from.GetPositionY(), from.GetPositionZ(), to.GetPositionX(), to.GetPositionY(), to.GetPositionZ(), GetPhaseMask(), checks, ignoreFlags);
     }
     return true;
 }
@@ -1354,25 +1344,37 @@ bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlag
    if (!IsInMap(obj))
         return false;
 
-    float ox, oy, oz;
-    if (obj->GetTypeId() == TYPEID_PLAYER)
+    Position from, to;
+    GetLineOfSightPoints(obj, from, to, collisionHeight, combatReach);
+    return GetMap()->isInLineOfSight(from.GetPositionX(), from.GetPositionY(), from.GetPositionZ(), to.GetPositionX(), to.GetPositionY(), to.GetPositionZ(), GetPhaseMask(), checks, ignoreFlags);
+}
+
+void WorldObject::GetLineOfSightPoints(float ox, float oy, float oz, Position& from, Position& to) const
+{
+    oz += GetCollisionHeight();
+    if (GetTypeId() == TYPEID_PLAYER)
     {
-        obj->GetPosition(ox, oy, oz);
-        oz += obj->GetCollisionHeight();
+        from.Relocate(GetPositionX(), GetPositionY(), GetPositionZ() + GetCollisionHeight());
     }
     else
-        obj->GetHitSpherePointFor({ GetPositionX(), GetPositionY(), GetPositionZ() + (collisionHeight ? *collisionHeight : GetCollisionHeight()) }, ox, oy, oz);
-
-    float x, y, z;
-    if (GetTypeId() == TYPEID_PLAYER)
     {
-        GetPosition(x, y, z);
-        z += GetCollisionHeight();
+        from = GetHitSpherePointFor({ ox, oy, oz });
     }
+
+    to.Relocate(ox, oy, oz);
+}
+
+void WorldObject::GetLineOfSightPoints(WorldObject const* obj, Position& from, Position& to, Optional<float> collisionHeight /*= { }*/, Optional<float> combatReach /*= { }*/) const
+{
+    if (obj->GetTypeId() == TYPEID_PLAYER)
+        to.Relocate(obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight());
     else
-        GetHitSpherePointFor({ obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight() }, x, y, z, collisionHeight, combatReach);
+        to = obj->GetHitSpherePointFor({ GetPositionX(), GetPositionY(), GetPositionZ() + (collisionHeight ? *collisionHeight : GetCollisionHeight()) });
 
-    return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+    if (GetTypeId() == TYPEID_PLAYER)
+        from.Relocate(GetPositionX(), GetPositionY(), GetPositionZ() + GetCollisionHeight());
+    else
+        from = GetHitSpherePointFor({ obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight() }, collisionHeight, combatReach);
 }
 
 void WorldObject::GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z, Optional<float> collisionHeight, Optional<float> combatReach) const
@@ -1749,8 +1751,8 @@ bool WorldObject::CanSeeOrDetect(WorldObject const* obj, bool ignoreStealth, boo
                 return false;
             }
 
-            ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_VISIBILITY, cObj->GetEntry());
-            if (!sConditionMgr->IsObjectMeetToConditions((WorldObject*)this, (WorldObject*)obj, conditions))
+            ConditionList const* conditions = sConditionMgr->FindConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_VISIBILITY, cObj->GetEntry());
+            if (conditions && !sConditionMgr->IsObjectMeetToConditions((WorldObject*)this, (WorldObject*)obj, *conditions))
             {
                 return false;
             }
@@ -90,6 +90,7 @@
 #include "Util.h"
 #include "Vehicle.h"
 #include "Weather.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -277,6 +278,8 @@ Player::Player(WorldSession* session): Unit(true), m_mover(this)
     ////////////////////Rest System/////////////////////
 
     m_mailsUpdated = false;
+    m_mailsLoaded = false;
+    m_mailListValidUntil = time_t(0);
     unReadMails = 0;
     m_nextMailDelivereTime = time_t(0);
 
@@ -1688,6 +1691,8 @@ void Player::AddToWorld()
     for (uint8 i = PLAYER_SLOT_START; i < PLAYER_SLOT_END; ++i)
         if (m_items[i])
             m_items[i]->AddToWorld();
+
+    sWhoListCacheMgr->QueueUpdate(GetGUID());
 }
 
 void Player::RemoveFromWorld()
@@ -1722,6 +1727,8 @@ void Player::RemoveFromWorld()
     ///- The player should only be removed when logging out
     Unit::RemoveFromWorld();
 
+    sWhoListCacheMgr->QueueUpdate(GetGUID());
+
     if (m_uint32Values)
     {
         if (WorldObject* viewpoint = GetViewpoint())
@@ -2258,6 +2265,16 @@ void Player::SetGMVisible(bool on)
 
         m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GM, GetSession()->GetSecurity());
     }
+
+    sWhoListCacheMgr->QueueUpdate(GetGUID());
+}
+
+void Player::SetInGuild(uint32 GuildId)
+{
+    SetUInt32Value(PLAYER_GUILDID, GuildId);
+    // xinef: update global storage
+    sCharacterCache->UpdateCharacterGuildId(GetGUID(), GetGuildId());
+    sWhoListCacheMgr->QueueUpdate(GetGUID());
 }
 
 bool Player::IsGroupVisibleFor(Player const* p) const
@@ -2805,6 +2822,7 @@ void Player::RemoveMail(uint32 id)
         {
             //do not delete item, because Player::removeMail() is called when returning mail to sender.
             m_mail.erase(itr);
+            ResetMailListPacket();
             return;
         }
     }
@@ -3754,6 +3772,20 @@ Mail* Player::GetMail(uint32 id)
     return nullptr;
 }
 
+WorldPacket const* Player::GetMailListPacket() const
+{
+    if (!m_mailListPacket || GameTime::GetGameTime().count() >= m_mailListValidUntil)
+        return nullptr;
+
+    return m_mailListPacket.get();
+}
+
+void Player::SetMailListPacket(WorldPacket&& packet, time_t validUntil)
+{
+    m_mailListPacket = std::make_unique<WorldPacket>(std::move(packet));
+    m_mailListValidUntil = validUntil;
+}
+
 void Player::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target) const
 {
     if (target == this)
@@ -15079,6 +15111,9 @@ void Player::SendDuelCountdown(uint32 counter)
 
 void Player::SetIsSpectator(bool on)
 {
+    // spectators are listed in Dalaran
+    sWhoListCacheMgr->QueueUpdate(GetGUID());
+
     if (on)
     {
         AddAura(SPECTATOR_SPELL_SPEED, this);
@@ -863,8 +863,6 @@ enum PlayerLoginQueryIndex
     PLAYER_LOGIN_QUERY_LOAD_REPUTATION              = 7,
     PLAYER_LOGIN_QUERY_LOAD_INVENTORY               = 8,
     PLAYER_LOGIN_QUERY_LOAD_ACTIONS                 = 9,
-    PLAYER_LOGIN_QUERY_LOAD_MAILS                   = 10,
-    PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS              = 11,
     PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST             = 13,
     PLAYER_LOGIN_QUERY_LOAD_HOME_BIND               = 14,
     PLAYER_LOGIN_QUERY_LOAD_SPELL_COOLDOWNS         = 15,
@@ -1603,9 +1601,19 @@ public:
 
     void RemoveMail(uint32 id);
 
-    void AddMail(Mail* mail) { m_mail.push_front(mail); }// for call from WorldSession::SendMailTo
+    void AddMail(Mail* mail) { m_mail.push_front(mail); ResetMailListPacket(); }// for call from WorldSession::SendMailTo
     uint32 GetMailSize() { return m_mail.size();}
     Mail* GetMail(uint32 id);
+    void SetMailsUpdated() { m_mailsUpdated = true; ResetMailListPacket(); }
+
+    // Mails and mailed items are loaded on the first mailbox open, mails received before stay in memory
+    [[nodiscard]] bool IsMailBoxLoaded() const { return m_mailsLoaded; }
+    void LoadMailBox(PreparedQueryResult mailsResult, PreparedQueryResult mailItemsResult);
+
+    // SMSG_MAIL_LIST_RESULT of the last mailbox open, valid until a mail changes, gets delivered or expires
+    [[nodiscard]] WorldPacket const* GetMailListPacket() const;
+    void SetMailListPacket(WorldPacket&& packet, time_t validUntil);
+    void ResetMailListPacket() { m_mailListPacket.reset(); }
 
     [[nodiscard]] PlayerMails const& GetMails() const { return m_mail; }
     void SendItemRetrievalMail(uint32 itemEntry, uint32 count); // Item retrieval mails sent by The Postmaster (34337)
@@ -1837,12 +1845,7 @@ public:
     void RemoveFromGroup(RemoveMethod method = GROUP_REMOVEMETHOD_DEFAULT) { RemoveFromGroup(GetGroup(), GetGUID(), method); }
     void SendUpdateToOutOfRangeGroupMembers();
 
-    void SetInGuild(uint32 GuildId)
-    {
-        SetUInt32Value(PLAYER_GUILDID, GuildId);
-        // xinef: update global storage
-        sCharacterCache->UpdateCharacterGuildId(GetGUID(), GetGuildId());
-    }
+    void SetInGuild(uint32 GuildId);
     void SetRank(uint8 rankId) { SetUInt32Value(PLAYER_GUILDRANK, rankId); }
     [[nodiscard]] uint8 GetRank() const { return uint8(GetUInt32Value(PLAYER_GUILDRANK)); }
     void SetGuildIdInvited(uint32 GuildId) { m_GuildIdInvited = GuildId; }
@@ -2732,6 +2735,9 @@ public:
     uint32 m_ArenaTeamIdInvited;
 
     PlayerMails m_mail;
+    bool m_mailsLoaded;
+    std::unique_ptr<WorldPacket> m_mailListPacket;
+    time_t m_mailListValidUntil;
     PlayerSpellMap m_spells;
     PlayerTalentMap m_talents;
     uint32 m_lastPotionId;                              // last used health/mana potion in combat, that block next potion use
@@ -5494,8 +5494,8 @@ bool Player::LoadFromDB(ObjectGuid playerGuid, CharacterDatabaseQueryHolder cons
     // must be before inventory (some items required reputation check)
     m_reputationMgr->LoadFromDB(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_REPUTATION));
 
-    // xinef: load mails before inventory, so problematic items can be added to already loaded mails
-    _LoadMail(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAILS), holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS));
+    // mails are loaded on the first mailbox open, only the new mail notification is needed at login
+    UpdateNextMailTimeAndUnreads();
 
     _LoadInventory(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_INVENTORY), time_diff);
 
@@ -6186,11 +6186,25 @@ Item* Player::_LoadMailedItem(ObjectGuid const& playerGuid, Player* player, uint
     return item;
 }
 
+void Player::LoadMailBox(PreparedQueryResult mailsResult, PreparedQueryResult mailItemsResult)
+{
+    if (m_mailsLoaded)
+        return;
+
+    m_mailsLoaded = true;
+
+    if (mailsResult)
+        _LoadMail(mailsResult, mailItemsResult);
+}
+
 void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mailItemsResult)
 {
     time_t cur_time = GameTime::GetGameTime().count();
 
-    m_mail.clear();
+    // Mails received before the mailbox was loaded are already in memory together with their items
+    std::unordered_set<uint32> receivedMails;
+    for (Mail const* mail : m_mail)
+        receivedMails.insert(mail->messageID);
 
     std::unordered_map<uint32, Mail*> mailById;
 
@@ -6199,15 +6213,27 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
         do
         {
             auto fields = mailsResult->Fetch();
+            uint32 messageID = fields[0].Get<uint32>();
+            time_t expireTime = time_t(fields[6].Get<uint32>());
+
+            if (receivedMails.contains(messageID))
+                continue;
+
+            if (cur_time > expireTime)
+            {
+                LOG_DEBUG("entities.player", "Player::_LoadMail: Mail ({}) has expired - ignored.", messageID);
+                continue;
+            }
+
             Mail* m = new Mail;
 
-            m->messageID      = fields[0].Get<uint32>();
+            m->messageID      = messageID;
             m->messageType    = fields[1].Get<uint8>();
             m->sender         = fields[2].Get<uint32>();
             m->receiver       = fields[3].Get<uint32>();
             m->subject        = fields[4].Get<std::string>();
             m->body           = fields[5].Get<std::string>();
-            m->expire_time    = time_t(fields[6].Get<uint32>());
+            m->expire_time    = expireTime;
             m->deliver_time   = time_t(fields[7].Get<uint32>());
             m->money          = fields[8].Get<uint32>();
             m->COD            = fields[9].Get<uint32>();
@@ -6215,12 +6241,6 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
             m->stationery     = fields[11].Get<uint8>();
             m->mailTemplateId = fields[12].Get<int16>();
 
-            if (cur_time > m->expire_time)
-            {
-                LOG_DEBUG("entities.player", "Player::_LoadMail: Mail ({}) has expired - ignored.", m->messageID);
-                continue;
-            }
-
             if (m->mailTemplateId && !sMailTemplateStore.LookupEntry(m->mailTemplateId))
             {
                 LOG_ERROR("entities.player", "Player::_LoadMail: Mail ({}) has nonexistent MailTemplateId ({}), remove at load", m->messageID, m->mailTemplateId);
@@ -6240,11 +6260,17 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
         {
             auto fields = mailItemsResult->Fetch();
             uint32 mailId = fields[14].Get<uint32>();
-            _LoadMailedItem(GetGUID(), this, mailId, mailById[mailId], fields);
+
+            // items of expired mails and of mails already in memory are not loaded
+            auto itr = mailById.find(mailId);
+            if (itr == mailById.end())
+                continue;
+
+            _LoadMailedItem(GetGUID(), this, mailId, itr->second, fields);
         } while (mailItemsResult->NextRow());
     }
 
-    UpdateNextMailTimeAndUnreads();
+    ResetMailListPacket();
 }
 
 void Player::LoadPet()
@@ -7811,7 +7837,7 @@ void Player::_SaveStats(CharacterDatabaseTransaction trans)
 
 void Player::outDebugValues() const
 {
-    if (!sLog->ShouldLog("entities.player", Warhead::LogLevel::Debug)) // optimize disabled debug output
+    if (!LOG_IS_ENABLED("entities.player", Warhead::LogLevel::Debug)) // optimize disabled debug output
         return;
 
     LOG_DEBUG("entities.player", "HP is: \t\t\t{}\t\tMP is: \t\t\t{}", GetMaxHealth(), GetMaxPower(POWER_MANA));
@@ -46,6 +46,7 @@
 #include "Vehicle.h"
 #include "Weather.h"
 #include "WeatherMgr.h"
+#include "WhoListCacheMgr.h"
 #include "WorldStatePackets.h"
 #include <fmt/printf.h>
 
@@ -1130,6 +1131,8 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea)
                                       // just area change, works strange...
         if (Guild* guild = GetGuild())
             guild->UpdateMemberData(this, GUILD_MEMBER_DATA_ZONEID, newZone);
+
+        sWhoListCacheMgr->QueueUpdate(GetGUID());
     }
 
     // group update
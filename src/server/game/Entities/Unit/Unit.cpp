@@ -73,8 +73,10 @@
 #include "UpdateFieldFlags.h"
 #include "Util.h"
 #include "Vehicle.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <boost/container/small_vector.hpp>
 #include <cmath>
 #include <sstream>
 
@@ -267,6 +269,8 @@ Unit::Unit(bool isWorldObject) : WorldObject(isWorldObject),
     m_auraUpdateIterator = m_ownedAuras.end();
 
     m_interruptMask = 0;
+    m_procAuraFlags = 0;
+    m_procAuraGeneration = sSpellMgr->GetProcDataGeneration();
     m_transform = 0;
     m_canModifyStats = false;
 
@@ -4401,6 +4405,7 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint8 effMask)
 
     AuraApplication* aurApp = new AuraApplication(this, caster, aura, effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
+    _AddProcAura(aurApp);
 
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: even if it gets removed, it will be reapplied in a second
@@ -4483,6 +4488,63 @@ void Unit::_ApplyAura(AuraApplication* aurApp, uint8 effMask)
     sScriptMgr->OnAuraApply(this, aura);
 }
 
+void Unit::_AddProcAura(AuraApplication* aurApp)
+{
+    if (m_procAuraGeneration != sSpellMgr->GetProcDataGeneration())
+    {
+        // m_appliedAuras already holds aurApp here
+        _RebuildProcAuraIndex();
+        return;
+    }
+
+    SpellInfo const* spellInfo = aurApp->GetBase()->GetSpellInfo();
+    uint32 procFlags = sSpellMgr->GetAuraProcEventFlags(spellInfo);
+    if (!procFlags)
+        return;
+
+    // multimap inserts at the end of the equal range, keep the same order
+    auto itr = std::upper_bound(m_procAuras.begin(), m_procAuras.end(), spellInfo->Id, [](uint32 spellId, ProcAuraEntry const& entry)
+    {
+        return spellId < entry.SpellId;
+    });
+
+    m_procAuras.insert(itr, { spellInfo->Id, procFlags, aurApp });
+    m_procAuraFlags |= procFlags;
+}
+
+void Unit::_RemoveProcAura(AuraApplication* aurApp)
+{
+    auto itr = std::find_if(m_procAuras.begin(), m_procAuras.end(), [aurApp](ProcAuraEntry const& entry)
+    {
+        return entry.AurApp == aurApp;
+    });
+
+    if (itr == m_procAuras.end())
+        return;
+
+    m_procAuras.erase(itr);
+
+    m_procAuraFlags = 0;
+    for (ProcAuraEntry const& entry : m_procAuras)
+        m_procAuraFlags |= entry.ProcFlags;
+}
+
+void Unit::_RebuildProcAuraIndex()
+{
+    m_procAuras.clear();
+    m_procAuraFlags = 0;
+    m_procAuraGeneration = sSpellMgr->GetProcDataGeneration();
+
+    for (auto const& [spellId, aurApp] : m_appliedAuras)
+    {
+        if (uint32 procFlags = sSpellMgr->GetAuraProcEventFlags(aurApp->GetBase()->GetSpellInfo()))
+        {
+            m_procAuras.push_back({ spellId, procFlags, aurApp });
+            m_procAuraFlags |= procFlags;
+        }
+    }
+}
+
 // removes aura application from lists and unapplies effects
 void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMode)
 {
@@ -4504,6 +4566,7 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
 
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
+    _RemoveProcAura(aurApp);
 
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: event if it gets removed, it will be reapplied in a second
@@ -15333,6 +15396,7 @@ void Unit::SetLevel(uint8 lvl, bool showLevelChange)
     if (GetTypeId() == TYPEID_PLAYER)
     {
         sCharacterCache->UpdateCharacterLevel(GetGUID(), lvl);
+        sWhoListCacheMgr->QueueUpdate(GetGUID());
     }
 }
 
@@ -15953,7 +16017,7 @@ struct ProcTriggeredData
     }
 };
 
-typedef std::list< ProcTriggeredData > ProcTriggeredList;
+typedef boost::container::small_vector<ProcTriggeredData, 8> ProcTriggeredList;
 
 // List of auras that CAN be trigger but may not exist in spell_proc_event
 // in most case need for drop charges
@@ -16245,25 +16309,43 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
 
     ProcEventInfo eventInfo = ProcEventInfo(actor, actionTarget, target, procFlag, 0, procPhase, procExtra, procSpell, damageInfo, healInfo, procAura, procAuraEffectIndex);
 
+    // Proc flags of an aura are resolved when it is applied, auras that can not be triggered by procFlag are never visited
+    if (m_procAuraGeneration != sSpellMgr->GetProcDataGeneration())
+        _RebuildProcAuraIndex();
+
+    if (!(m_procAuraFlags & procFlag))
+        return;
+
+    // Scripts may apply or remove auras while checking, work on a snapshot
+    boost::container::small_vector<AuraApplication*, 16> procAuras;
+    for (ProcAuraEntry const& entry : m_procAuras)
+        if (entry.ProcFlags & procFlag)
+            procAuras.push_back(entry.AurApp);
+
     ProcTriggeredList procTriggered;
     // Fill procTriggered list
-    for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
+    for (AuraApplication* aurApp : procAuras)
     {
+        if (aurApp->GetRemoveMode())
+            continue;
+
+        uint32 aurId = aurApp->GetBase()->GetId();
+
         // Do not allow auras to proc from effect triggered by itself
-        if (procAura && procAura->Id == itr->first)
+        if (procAura && procAura->Id == aurId)
             continue;
 
         // Xinef: Generic Item Equipment cooldown, -1 is a special marker
-        if (itr->second->GetBase()->GetCastItemGUID() && HasSpellItemCooldown(itr->first, uint32(-1)))
+        if (aurApp->GetBase()->GetCastItemGUID() && HasSpellItemCooldown(aurId, uint32(-1)))
             continue;
 
-        ProcTriggeredData triggerData(itr->second->GetBase());
+        ProcTriggeredData triggerData(aurApp->GetBase());
         // Defensive procs are active on absorbs (so absorption effects are not a hindrance)
         bool active = damage || (procExtra & PROC_EX_BLOCK && isVictim);
         if (isVictim)
             procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
 
-        SpellInfo const* spellProto = itr->second->GetBase()->GetSpellInfo();
+        SpellInfo const* spellProto = aurApp->GetBase()->GetSpellInfo();
 
         // only auras that have trigger spell should proc from fully absorbed damage
         if (procExtra & PROC_EX_ABSORB && isVictim)
@@ -16276,7 +16358,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
             active = true;
 
         // AuraScript Hook
-        if (!triggerData.aura->CallScriptCheckProcHandlers(itr->second, eventInfo))
+        if (!triggerData.aura->CallScriptCheckProcHandlers(aurApp, eventInfo))
         {
             continue;
         }
@@ -16284,7 +16366,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         bool isTriggeredAtSpellProcEvent = IsTriggeredAtSpellProcEvent(target, triggerData.aura, attType, isVictim, active, triggerData.spellProcEvent, eventInfo);
 
         // AuraScript Hook
-        triggerData.aura->CallScriptCheckAfterProcHandlers(itr->second, eventInfo);
+        triggerData.aura->CallScriptCheckAfterProcHandlers(aurApp, eventInfo);
 
         if (!isTriggeredAtSpellProcEvent)
         {
@@ -16292,11 +16374,13 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         }
 
         // do checks using conditions table
-        ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, spellProto->Id);
-        ConditionSourceInfo condInfo = ConditionSourceInfo(eventInfo.GetActor(), eventInfo.GetActionTarget());
-        if (!sConditionMgr->IsObjectMeetToConditions(condInfo, conditions))
+        if (ConditionList const* conditions = sConditionMgr->FindConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, spellProto->Id))
         {
-            continue;
+            ConditionSourceInfo condInfo = ConditionSourceInfo(eventInfo.GetActor(), eventInfo.GetActionTarget());
+            if (!sConditionMgr->IsObjectMeetToConditions(condInfo, *conditions))
+            {
+                continue;
+            }
         }
 
         // Triggered spells not triggering additional spells
@@ -16306,9 +16390,9 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         bool hasTriggeredProc = false;
         for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         {
-            if (itr->second->HasEffect(i))
+            if (aurApp->HasEffect(i))
             {
-                AuraEffect* aurEff = itr->second->GetBase()->GetEffect(i);
+                AuraEffect* aurEff = aurApp->GetBase()->GetEffect(i);
 
                 // Skip this auras
                 if (isNonTriggerAura[aurEff->GetAuraType()])
@@ -16363,12 +16447,12 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
 
                 if (!proccessed)
                 {
-                    procTriggered.push_front(triggerData);
+                    procTriggered.insert(procTriggered.begin(), triggerData);
                 }
             }
             else
             {
-                procTriggered.push_front(triggerData);
+                procTriggered.insert(procTriggered.begin(), triggerData);
             }
         }
     }
@@ -1306,6 +1306,15 @@ public:
     typedef std::list<AuraEffect*> AuraEffectList;
     typedef std::list<Aura*> AuraList;
     typedef std::list<AuraApplication*> AuraApplicationList;
+
+    // applied auras that can be triggered through spell_proc_event, kept in m_appliedAuras order
+    struct ProcAuraEntry
+    {
+        uint32 SpellId;
+        uint32 ProcFlags;
+        AuraApplication* AurApp;
+    };
+    typedef std::vector<ProcAuraEntry> ProcAuraIndex;
     typedef std::list<DiminishingReturn> Diminishing;
     typedef GuidUnorderedSet ComboPointHolderSet;
 
@@ -1906,6 +1915,9 @@ public:
     void _RemoveNoStackAurasDueToAura(Aura* aura);
     bool _IsNoStackAuraDueToAura(Aura* appliedAura, Aura* existingAura) const;
     void _RegisterAuraEffect(AuraEffect* aurEff, bool apply);
+    void _AddProcAura(AuraApplication* aurApp);
+    void _RemoveProcAura(AuraApplication* aurApp);
+    void _RebuildProcAuraIndex();
 
     // m_ownedAuras container management
     AuraMap&       GetOwnedAuras()       { return m_ownedAuras; }
@@ -2504,6 +2516,9 @@ protected:
     AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
     AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
     uint32 m_interruptMask;
+    ProcAuraIndex m_procAuras;                 // Used for improve performance of proc lookup, see ProcDamageAndSpellFor
+    uint32 m_procAuraFlags;                    // union of m_procAuras proc flags
+    uint32 m_procAuraGeneration;               // SpellMgr proc data generation m_procAuras was built against
 
     float m_auraModifiersGroup[UNIT_MOD_END][MODIFIER_TYPE_END];
     float m_weaponDamage[MAX_ATTACK][MAX_WEAPON_DAMAGE_RANGE][MAX_ITEM_PROTO_DAMAGES];
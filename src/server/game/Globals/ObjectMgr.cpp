@@ -303,6 +303,7 @@ ObjectMgr::ObjectMgr():
     _auctionId(1),
     _equipmentSetGuid(1),
     _mailId(1),
+    _expiredMailSweepId(0),
     _hiPetNumber(1),
     _creatureSpawnId(1),
     _gameObjectSpawnId(1)
@@ -1924,12 +1925,11 @@ void ObjectMgr::LoadCreatures()
     uint32 count = 0;
     do
     {
-        auto fields = result->Fetch();
-
-        ObjectGuid::LowType spawnId     = fields[0].Get<uint32>();
-        uint32 id1                      = fields[1].Get<uint32>();
-        uint32 id2                      = fields[2].Get<uint32>();
-        uint32 id3                      = fields[3].Get<uint32>();
+        auto [spawnId, id1, id2, id3, mapId, equipmentId, posX, posY, posZ, orientation, spawntimesecs, wanderDistance,
+            currentWaypoint, curHealth, curMana, movementType, spawnMask, phaseMask, gameEvent, PoolId, npcFlag, unitFlags, dynamicFlags,
+            scriptName] = result->As<ObjectGuid::LowType, uint32, uint32, uint32, uint16, int8, float, float, float, float, uint32, float,
+            uint32, uint32, uint32, uint8, uint8, uint32, int8, uint32, uint32, uint32, uint32,
+            std::string_view>();
 
         CreatureTemplate const* cInfo = GetCreatureTemplate(id1);
         if (!cInfo)
@@ -1958,26 +1958,24 @@ void ObjectMgr::LoadCreatures()
         data.id1                = id1;
         data.id2                = id2;
         data.id3                = id3;
-        data.mapid              = fields[4].Get<uint16>();
-        data.equipmentId        = fields[5].Get<int8>();
-        data.posX               = fields[6].Get<float>();
-        data.posY               = fields[7].Get<float>();
-        data.posZ               = fields[8].Get<float>();
-        data.orientation        = fields[9].Get<float>();
-        data.spawntimesecs      = fields[10].Get<uint32>();
-        data.wander_distance    = fields[11].Get<float>();
-        data.currentwaypoint    = fields[12].Get<uint32>();
-        data.curhealth          = fields[13].Get<uint32>();
-        data.curmana            = fields[14].Get<uint32>();
-        data.movementType       = fields[15].Get<uint8>();
-        data.spawnMask          = fields[16].Get<uint8>();
-        data.phaseMask          = fields[17].Get<uint32>();
-        int16 gameEvent         = fields[18].Get<int8>();
-        uint32 PoolId           = fields[19].Get<uint32>();
-        data.npcflag            = fields[20].Get<uint32>();
-        data.unit_flags         = fields[21].Get<uint32>();
-        data.dynamicflags       = fields[22].Get<uint32>();
-        data.ScriptId           = GetScriptId(fields[23].Get<std::string>());
+        data.mapid              = mapId;
+        data.equipmentId        = equipmentId;
+        data.posX               = posX;
+        data.posY               = posY;
+        data.posZ               = posZ;
+        data.orientation        = orientation;
+        data.spawntimesecs      = spawntimesecs;
+        data.wander_distance    = wanderDistance;
+        data.currentwaypoint    = currentWaypoint;
+        data.curhealth          = curHealth;
+        data.curmana            = curMana;
+        data.movementType       = movementType;
+        data.spawnMask          = spawnMask;
+        data.phaseMask          = phaseMask;
+        data.npcflag            = npcFlag;
+        data.unit_flags         = unitFlags;
+        data.dynamicflags       = dynamicFlags;
+        data.ScriptId           = GetScriptId(scriptName);
 
         if (!data.ScriptId)
             data.ScriptId = cInfo->ScriptID;
@@ -5614,16 +5612,70 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
     StopWatch sw;
     time_t curTime = GameTime::GetGameTime().count();
+    uint32 batchSize = std::max<uint32>(CONF_GET_UINT("Mail.ExpiredSweep.BatchSize"), 1);
+
+    uint32 deletedCount = 0;
+    uint32 returnedCount = 0;
+
+    if (serverUp)
+    {
+        // One batch per call, the next one continues after the last mail of this batch.
+        // A short batch means the end of the table was reached, start over from the first mail.
+        if (_ReturnOrDeleteOldMailsBatch(curTime, true, batchSize, deletedCount, returnedCount) < batchSize)
+            _expiredMailSweepId = 0;
+
+        if (deletedCount || returnedCount)
+            LOG_DEBUG("server.worldserver", "Processed {} expired mails: {} deleted and {} returned in {}", deletedCount + returnedCount, deletedCount, returnedCount, sw);
+
+        return;
+    }
 
+    _expiredMailSweepId = 0;
+    while (_ReturnOrDeleteOldMailsBatch(curTime, false, batchSize, deletedCount, returnedCount) == batchSize) { }
+    _expiredMailSweepId = 0;
+
+    LOG_INFO("server.loading", ">> Processed {} expired mails: {} deleted and {} returned in {}", deletedCount + returnedCount, deletedCount, returnedCount, sw);
+    LOG_INFO("server.loading", " ");
+}
+
+uint32 ObjectMgr::_ReturnOrDeleteOldMailsBatch(time_t curTime, bool serverUp, uint32 batchSize, uint32& deletedCount, uint32& returnedCount)
+{
     CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
     stmt->SetData(0, uint32(curTime));
+    stmt->SetData(1, _expiredMailSweepId);
+    stmt->SetData(2, batchSize);
     PreparedQueryResult result = CharacterDatabase.Query(stmt);
     if (!result)
-        return;
+        return 0;
 
-    std::map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
+    std::vector<std::pair<Mail, bool /*has_items*/>> mails;
+    mails.reserve(result->GetRowCount());
+
+    do
+    {
+        auto fields = result->Fetch();
+        auto& [m, has_items] = mails.emplace_back();
+        m.messageID      = fields[0].Get<uint32>();
+        m.messageType    = fields[1].Get<uint8>();
+        m.sender         = fields[2].Get<uint32>();
+        m.receiver       = fields[3].Get<uint32>();
+        has_items        = fields[4].Get<bool>();
+        m.expire_time    = time_t(fields[5].Get<uint32>());
+        m.deliver_time   = time_t(0);
+        m.stationery     = fields[6].Get<uint8>();
+        m.checked        = fields[7].Get<uint8>();
+        m.mailTemplateId = fields[8].Get<int16>();
+    } while (result->NextRow());
+
+    // items are read for the id range of this batch only
+    uint32 firstMailId = _expiredMailSweepId;
+    _expiredMailSweepId = mails.back().first.messageID;
+
+    std::unordered_map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
     stmt->SetData(0, uint32(curTime));
+    stmt->SetData(1, firstMailId);
+    stmt->SetData(2, _expiredMailSweepId);
     if (PreparedQueryResult items = CharacterDatabase.Query(stmt))
     {
         MailItemInfo item;
@@ -5637,33 +5689,15 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         } while (items->NextRow());
     }
 
-    uint32 deletedCount = 0;
-    uint32 returnedCount = 0;
-
-    do
+    for (auto& [mail, has_items] : mails)
     {
-        auto fields = result->Fetch();
-        Mail* m = new Mail;
-        m->messageID      = fields[0].Get<uint32>();
-        m->messageType    = fields[1].Get<uint8>();
-        m->sender         = fields[2].Get<uint32>();
-        m->receiver       = fields[3].Get<uint32>();
-        bool has_items    = fields[4].Get<bool>();
-        m->expire_time    = time_t(fields[5].Get<uint32>());
-        m->deliver_time   = time_t(0);
-        m->stationery     = fields[6].Get<uint8>();
-        m->checked        = fields[7].Get<uint8>();
-        m->mailTemplateId = fields[8].Get<int16>();
-
-        Player* player = nullptr;
-        if (serverUp)
-            player = ObjectAccessor::FindPlayerByLowGUID(m->receiver);
+        Mail* m = &mail;
 
-        if (player) // don't modify mails of a logged in player
-        {
-            delete m;
-            continue;
-        }
+        // don't modify mails of a logged in player once they are in memory or being loaded, the mailbox is saved from there
+        if (serverUp)
+            if (Player* player = ObjectAccessor::FindPlayerByLowGUID(m->receiver))
+                if (player->IsMailBoxLoaded() || player->GetSession()->IsMailBoxLoading() || player->GetMail(m->messageID))
+                    continue;
 
         // Delete or return mail
         if (has_items)
@@ -5714,7 +5748,6 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
                 sCharacterCache->IncreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->sender));
                 sCharacterCache->DecreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->receiver));
 
-                delete m;
                 ++returnedCount;
                 continue;
             }
@@ -5725,12 +5758,10 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
         stmt->SetData(0, m->messageID);
         CharacterDatabase.Execute(stmt);
-        delete m;
         ++deletedCount;
-    } while (result->NextRow());
+    }
 
-    LOG_INFO("server.loading", ">> Processed {} expired mails: {} deleted and {} returned in {}", deletedCount + returnedCount, deletedCount, returnedCount, sw);
-    LOG_INFO("server.loading", " ");
+    return uint32(mails.size());
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
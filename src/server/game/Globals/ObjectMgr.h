@@ -1008,6 +1008,7 @@ public:
         return itr != _fishingBaseForAreaStore.end() ? itr->second : 0;
     }
 
+    // At startup all expired mails are processed, while the server is up every call handles one batch
     void ReturnOrDeleteOldMails(bool serverUp);
 
     CreatureBaseStats const* GetCreatureBaseStats(uint8 level, uint8 unitClass);
@@ -1231,6 +1232,7 @@ private:
     uint64 _equipmentSetGuid; // pussywizard: accessed by a single thread
     uint32 _mailId;
     std::mutex _mailIdMutex;
+    uint32 _expiredMailSweepId; // last mail id handled by the expired mail sweep, accessed by a single thread
     uint32 _hiPetNumber;
     std::mutex _hiPetNumberMutex;
 
@@ -1304,6 +1306,8 @@ private:
     void LoadScripts(ScriptsType type);
     void LoadQuestRelationsHelper(QuestRelations& map, std::string const& table, bool starter, bool go);
     void PlayerCreateInfoAddItemHelper(uint32 race_, uint32 class_, uint32 itemId, int32 count);
+    // Returns the number of expired mails read, mails of players who have them in memory are skipped
+    uint32 _ReturnOrDeleteOldMailsBatch(time_t curTime, bool serverUp, uint32 batchSize, uint32& deletedCount, uint32& returnedCount);
 
     MailLevelRewardContainer _mailLevelRewardStore;
 
@@ -39,6 +39,7 @@
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
+#include "WhoListCacheMgr.h"
 #include "WorldSession.h"
 #include <boost/iterator/counting_iterator.hpp>
 
@@ -139,13 +140,21 @@ void Guild::SendSaveEmblemResult(WorldSession* session, GuildEmblemError errCode
 // LogHolder
 template <typename Entry>
 Guild::LogHolder<Entry>::LogHolder()
-    : m_maxRecords(std::is_same_v<Entry, BankEventLogEntry> ? CONF_GET_UINT("Guild.BankEventLogRecordsCount") : CONF_GET_UINT("Guild.EventLogRecordsCount")),
+    : m_head(0), m_count(0),
+    m_maxRecords(std::is_same_v<Entry, BankEventLogEntry> ? CONF_GET_UINT("Guild.BankEventLogRecordsCount") : CONF_GET_UINT("Guild.EventLogRecordsCount")),
     m_nextGUID(uint32(GUILD_EVENT_LOG_GUID_UNDEFINED)) { }
 
 template <typename Entry> template <typename... Ts>
 void Guild::LogHolder<Entry>::LoadEvent(Ts&&... args)
 {
-    Entry const& newEntry = m_log.emplace_front(std::forward<Ts>(args)...);
+    if (m_log.empty())
+        m_log.resize(m_maxRecords);
+
+    // Loaded events are older than everything already stored, put them in front of the oldest one
+    m_head = (m_head + m_log.size() - 1) % m_log.size();
+    ++m_count;
+
+    Entry const& newEntry = m_log[m_head].emplace(std::forward<Ts>(args)...);
     if (m_nextGUID == uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
         m_nextGUID = newEntry.GetGUID();
 }
@@ -153,13 +162,22 @@ void Guild::LogHolder<Entry>::LoadEvent(Ts&&... args)
 template <typename Entry> template <typename... Ts>
 void Guild::LogHolder<Entry>::AddEvent(CharacterDatabaseTransaction trans, Ts&&... args)
 {
-    // Check max records limit
-    if (!CanInsert())
+    if (m_log.empty())
+        m_log.resize(m_maxRecords);
+
+    std::size_t slot = m_head;
+
+    // Check max records limit, the oldest entry is overwritten when the ring is full
+    if (CanInsert())
     {
-        m_log.pop_front();
+        slot = (m_head + m_count) % m_log.size();
+        ++m_count;
     }
-    // Add event to list
-    Entry const& entry = m_log.emplace_back(std::forward<Ts>(args)...);
+    else
+        m_head = (m_head + 1) % m_log.size();
+
+    // Add event to ring
+    Entry const& entry = m_log[slot].emplace(std::forward<Ts>(args)...);
     // Save to DB
     entry.SaveToDB(trans);
 }
@@ -1038,7 +1056,8 @@ Guild::Guild():
     m_id(0),
     m_createdDate(0),
     m_accountsNumber(0),
-    m_bankMoney(0)
+    m_bankMoney(0),
+    m_rosterVersion(1)
 {
 }
 
@@ -1174,7 +1193,8 @@ void Guild::UpdateMemberData(Player* player, uint8 dataid, uint32 value)
                 LOG_ERROR("guild", "Guild::UpdateMemberData: Called with incorrect DATAID {} (value {})", dataid, value);
                 return;
         }
-        //HandleRoster();
+
+        _InvalidateRoster();
     }
 }
 
@@ -1185,6 +1205,8 @@ void Guild::OnPlayerStatusChange(Player* player, uint32 flag, bool state)
         if (state)
             member->AddFlag(flag);
         else member->RemFlag(flag);
+
+        _InvalidateRoster();
     }
 }
 
@@ -1200,10 +1222,43 @@ bool Guild::SetName(std::string_view const& name)
     stmt->SetData(0, m_name);
     stmt->SetData(1, GetId());
     CharacterDatabase.Execute(stmt);
+
+    // offline members are skipped by the who list
+    for (auto const& [guid, member] : m_members)
+        sWhoListCacheMgr->QueueUpdate(member.GetGUID());
+
     return true;
 }
 
 void Guild::HandleRoster(WorldSession* session)
+{
+    bool sendOfficerNote = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
+    Seconds now = GameTime::GetGameTime();
+
+    std::shared_ptr<WorldPacket const> packet;
+
+    {
+        std::lock_guard<std::mutex> guard(m_rosterCacheLock);
+
+        // read before building, a change made meanwhile invalidates the new packet
+        uint32 version = m_rosterVersion.load(std::memory_order_acquire);
+
+        RosterCache& cache = m_rosterCache[sendOfficerNote ? 1 : 0];
+        if (!cache.Packet || cache.Version != version || now - cache.BuiltTime >= GUILD_ROSTER_CACHE_TIME)
+        {
+            cache.Packet = _BuildRosterPacket(sendOfficerNote);
+            cache.Version = version;
+            cache.BuiltTime = now;
+        }
+
+        packet = cache.Packet;
+    }
+
+    LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [{}]", session->GetPlayerInfo());
+    session->SendPacket(packet);
+}
+
+std::shared_ptr<WorldPacket const> Guild::_BuildRosterPacket(bool sendOfficerNote) const
 {
     WorldPackets::Guild::GuildRoster roster;
 
@@ -1220,7 +1275,7 @@ void Guild::HandleRoster(WorldSession* session)
         }
     }
 
-    bool sendOfficerNote = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
+    roster.MemberData.reserve(m_members.size());
     for (auto const& [guid, member] : m_members)
     {
         WorldPackets::Guild::GuildRosterMemberData& memberData = roster.MemberData.emplace_back();
@@ -1244,8 +1299,7 @@ void Guild::HandleRoster(WorldSession* session)
     roster.WelcomeText = m_motd;
     roster.InfoText = m_info;
 
-    LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [{}]", session->GetPlayerInfo());
-    session->SendPacket(roster.Write());
+    return std::make_shared<WorldPacket const>(*roster.Write());
 }
 
 void Guild::HandleQuery(WorldSession* session)
@@ -1281,6 +1335,7 @@ void Guild::HandleSetMOTD(WorldSession* session, std::string_view motd)
     else
     {
         m_motd = motd;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildMOTDChanged(this, m_motd);
 
@@ -1302,6 +1357,7 @@ void Guild::HandleSetInfo(WorldSession* session, std::string_view info)
     if (_HasRankRight(session->GetPlayer(), GR_RIGHT_MODIFY_GUILD_INFO))
     {
         m_info = info;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildInfoChanged(this, m_info);
 
@@ -1346,6 +1402,7 @@ void Guild::HandleSetLeader(WorldSession* session, std::string_view name)
         {
             _SetLeaderGUID(*pNewLeader);
             pOldLeader->ChangeRank(GR_OFFICER);
+            _InvalidateRoster();
             _BroadcastEvent(GE_LEADER_CHANGED, ObjectGuid::Empty, player->GetName(), pNewLeader->GetName());
         }
     }
@@ -1377,6 +1434,7 @@ void Guild::HandleSetMemberNote(WorldSession* session, std::string_view name, st
         else
             member->SetOfficerNote(note);
 
+        _InvalidateRoster();
         HandleRoster(session);
     }
 }
@@ -1391,6 +1449,7 @@ void Guild::HandleSetRankInfo(WorldSession* session, uint8 rankId, std::string_v
         rankInfo->SetName(name);
         rankInfo->SetRights(rights);
         _SetRankBankMoneyPerDay(rankId, moneyPerDay);
+        _InvalidateRoster();
 
         for (auto rightsAndSlot : rightsAndSlots)
             _SetRankBankTabRightsAndSlots(rankId, rightsAndSlot);
@@ -1606,6 +1665,7 @@ void Guild::HandleUpdateMemberRank(WorldSession* session, std::string_view name,
 
         uint32 newRankId = member->GetRankId() + (demote ? 1 : -1);
         member->ChangeRank(newRankId);
+        _InvalidateRoster();
         _LogEvent(demote ? GUILD_EVENT_LOG_DEMOTE_PLAYER : GUILD_EVENT_LOG_PROMOTE_PLAYER, player->GetGUID(), member->GetGUID(), newRankId);
         _BroadcastEvent(demote ? GE_DEMOTION : GE_PROMOTION, ObjectGuid::Empty, player->GetName(), member->GetName(), _GetRankName(newRankId));
     }
@@ -1647,6 +1707,7 @@ void Guild::HandleRemoveRank(WorldSession* session, uint8 rankId)
 
     // match what the sql statement does
     m_ranks.erase(m_ranks.begin() + rankId, m_ranks.end());
+    _InvalidateRoster();
 
     _BroadcastEvent(GE_RANK_DELETED, ObjectGuid::Empty, std::to_string(m_ranks.size()));
 }
@@ -1737,6 +1798,7 @@ void Guild::HandleMemberLogout(WorldSession* session)
         member->SetStats(player);
         member->UpdateLogoutTime();
         member->ResetFlags();
+        _InvalidateRoster();
     }
     _BroadcastEvent(GE_SIGNED_OFF, player->GetGUID(), player->GetName());
 }
@@ -1767,13 +1829,13 @@ void Guild::SendInfo(WorldSession* session) const
 
 void Guild::SendEventLog(WorldSession* session) const
 {
-    std::list<EventLogEntry> const& eventLog = m_eventLog.GetGuildLog();
-
     WorldPackets::Guild::GuildEventLogQueryResults packet;
-    packet.Entry.reserve(eventLog.size());
+    packet.Entry.reserve(m_eventLog.GetSize());
 
-    for (EventLogEntry const& entry : eventLog)
+    m_eventLog.DoForAllEntries([&packet](EventLogEntry const& entry)
+    {
         entry.WritePacket(packet);
+    });
 
     session->SendPacket(packet.Write());
     LOG_DEBUG("guild", "MSG_GUILD_EVENT_LOG_QUERY [{}]", session->GetPlayerInfo());
@@ -1784,14 +1846,16 @@ void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
     // GUILD_BANK_MAX_TABS send by client for money log
     if (tabId < _GetPurchasedTabsSize() || tabId == GUILD_BANK_MAX_TABS)
     {
-        std::list<BankEventLogEntry> const& bankEventLog = m_bankEventLog[tabId].GetGuildLog();
+        LogHolder<BankEventLogEntry> const& bankEventLog = m_bankEventLog[tabId];
 
         WorldPackets::Guild::GuildBankLogQueryResults packet;
         packet.Tab = tabId;
 
-        packet.Entry.reserve(bankEventLog.size());
-        for (BankEventLogEntry const& entry : bankEventLog)
+        packet.Entry.reserve(bankEventLog.GetSize());
+        bankEventLog.DoForAllEntries([&packet](BankEventLogEntry const& entry)
+        {
             entry.WritePacket(packet);
+        });
 
         session->SendPacket(packet.Write());
         LOG_DEBUG("guild", "MSG_GUILD_BANK_LOG_QUERY [{}]", session->GetPlayerInfo());
@@ -1883,6 +1947,7 @@ void Guild::SendLoginInfo(WorldSession* session)
     {
         member->SetStats(player);
         member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
+        _InvalidateRoster();
     }
 }
 
@@ -2116,17 +2181,31 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const
 {
+    // copied once on the first online receiver and shared by every session after that
+    std::shared_ptr<WorldPacket const> shared;
     for (auto const& [guid, member] : m_members)
         if (member.IsRank(rankId))
             if (Player* player = member.FindPlayer())
-                player->GetSession()->SendPacket(packet);
+            {
+                if (!shared)
+                    shared = std::make_shared<WorldPacket const>(*packet);
+
+                player->GetSession()->SendPacket(shared);
+            }
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
+    // copied once on the first online receiver and shared by every session after that
+    std::shared_ptr<WorldPacket const> shared;
     for (auto const& [guid, member] : m_members)
         if (Player* player = member.FindPlayer())
-            player->GetSession()->SendPacket(packet);
+        {
+            if (!shared)
+                shared = std::make_shared<WorldPacket const>(*packet);
+
+            player->GetSession()->SendPacket(shared);
+        }
 }
 
 void Guild::MassInviteToEvent(WorldSession* session, uint32 minLevel, uint32 maxLevel, uint32 minRank)
@@ -2235,6 +2314,7 @@ bool Guild::AddMember(ObjectGuid guid, uint8 rankId)
 
     CharacterDatabaseTransaction trans(nullptr);
     member.SaveToDB(trans);
+    _InvalidateRoster();
 
     _UpdateAccountsNumber();
     _LogEvent(GUILD_EVENT_LOG_JOIN_GUILD, guid);
@@ -2290,6 +2370,7 @@ void Guild::DeleteMember(ObjectGuid guid, bool isDisbanding, bool isKicked, bool
     sScriptMgr->OnGuildRemoveMember(this, player, isDisbanding, isKicked);
 
     m_members.erase(lowguid);
+    _InvalidateRoster();
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
     if (player)
@@ -2313,6 +2394,7 @@ bool Guild::ChangeMemberRank(ObjectGuid guid, uint8 newRank)
         if (Member* member = GetMember(guid))
         {
             member->ChangeRank(newRank);
+            _InvalidateRoster();
 
             if (newRank == GR_GUILDMASTER)
             {
@@ -2390,6 +2472,7 @@ void Guild::_CreateNewBankTab()
         m_rank.CreateMissingTabsIfNeeded(tabId, trans, false);
 
     CharacterDatabase.CommitTransaction(trans);
+    _InvalidateRoster();
 }
 
 void Guild::_CreateDefaultGuildRanks(LocaleConstant loc)
@@ -2418,6 +2501,7 @@ bool Guild::_CreateRank(std::string_view name, uint32 rights)
     // Ranks represent sequence 0, 1, 2, ... where 0 means guildmaster
     RankInfo info(m_id, newRankId, name, rights, 0);
     m_ranks.push_back(info);
+    _InvalidateRoster();
 
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     info.CreateMissingTabsIfNeeded(_GetPurchasedTabsSize(), trans);
@@ -2483,6 +2567,7 @@ void Guild::_SetLeaderGUID(Member& pLeader)
 {
     m_leaderGuid = pLeader.GetGUID();
     pLeader.ChangeRank(GR_GUILDMASTER);
+    _InvalidateRoster();
 
     CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_LEADER);
     stmt->SetData(0, m_leaderGuid.GetCounter());
@@ -2502,7 +2587,10 @@ void Guild::_SetRankBankTabRightsAndSlots(uint8 rankId, GuildBankRightsAndSlots
         return;
 
     if (RankInfo* rankInfo = GetRankInfo(rankId))
+    {
         rankInfo->SetBankTabSlotsAndRights(rightsAndSlots, saveToDB);
+        _InvalidateRoster();
+    }
 }
 
 inline std::string Guild::_GetRankName(uint8 rankId) const
@@ -23,6 +23,8 @@
 #include "Player.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <atomic>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 
@@ -50,6 +52,7 @@ enum GuildMisc
 };
 
 constexpr uint64 GUILD_BANK_MONEY_LIMIT = UI64LIT(0x7FFFFFFFFFFFF);
+constexpr Seconds GUILD_ROSTER_CACHE_TIME = 60s;               // keeps the "last online" time of offline members fresh
 
 enum GuildMemberData
 {
@@ -477,6 +480,8 @@ private:
     };
 
     // Class encapsulating work with events collection
+    // Entries are kept in a fixed-capacity ring allocated on the first insert, once it is full
+    // every new entry overwrites the oldest one in place.
     template <typename Entry>
     class LogHolder
     {
@@ -485,20 +490,30 @@ private:
 
         uint32 GetGuildId() const { return m_guildId; }
         // Checks if new log entry can be added to holder
-        bool CanInsert() const { return m_log.size() < m_maxRecords; }
-        // Adds event from DB to collection
+        bool CanInsert() const { return m_count < m_maxRecords; }
+        // Adds event from DB to collection, events are loaded from the newest to the oldest
         template <typename... Ts>
         void LoadEvent(Ts&&... args);
         // Adds new event to collection and saves it to DB
         template <typename... Ts>
         void AddEvent(CharacterDatabaseTransaction trans, Ts&&... args);
         uint32 GetNextGUID();
-        std::list<Entry>& GetGuildLog() { return m_log; }
-        std::list<Entry> const& GetGuildLog() const { return m_log; }
+
+        std::size_t GetSize() const { return m_count; }
+
+        // Calls fn for every entry, from the oldest to the newest
+        template <typename Fn>
+        void DoForAllEntries(Fn&& fn) const
+        {
+            for (std::size_t i = 0; i < m_count; ++i)
+                fn(*m_log[(m_head + i) % m_log.size()]);
+        }
 
     private:
         uint32 m_guildId;
-        std::list<Entry> m_log;
+        std::vector<Optional<Entry>> m_log;
+        std::size_t m_head;                                 // slot of the oldest entry
+        std::size_t m_count;
         uint32 const m_maxRecords;
         uint32 m_nextGUID;
     };
@@ -795,10 +810,22 @@ protected:
     std::unordered_map<uint32, Member> m_members;
     std::vector<BankTab> m_bankTabs;
 
-    // These are actually ordered lists. The first element is the oldest entry.
     LogHolder<EventLogEntry> m_eventLog;
     std::array<LogHolder<BankEventLogEntry>, GUILD_BANK_MAX_TABS + 1> m_bankEventLog = {};
 
+    // Roster packet built once and shared by every requester until the roster version changes,
+    // one per officer note visibility
+    struct RosterCache
+    {
+        std::shared_ptr<WorldPacket const> Packet;
+        uint32 Version = 0;
+        Seconds BuiltTime = 0s;
+    };
+
+    std::array<RosterCache, 2> m_rosterCache;
+    std::atomic<uint32> m_rosterVersion; // bumped by map threads too, on zone and level changes of members
+    std::mutex m_rosterCacheLock; // roster requests of several members may be handled in parallel
+
 private:
     inline uint8 _GetRanksSize() const { return uint8(m_ranks.size()); }
     inline const RankInfo* GetRankInfo(uint8 rankId) const { return rankId < _GetRanksSize() ? &m_ranks[rankId] : nullptr; }
@@ -819,6 +846,10 @@ private:
 
     inline void _DeleteMemberFromDB(ObjectGuid::LowType lowguid) const;
 
+    // Must be called whenever a member, a rank or the guild texts shown in the roster change
+    inline void _InvalidateRoster() { m_rosterVersion.fetch_add(1, std::memory_order_release); }
+    std::shared_ptr<WorldPacket const> _BuildRosterPacket(bool sendOfficerNote) const;
+
     // Tries to create new bank tab
     void _CreateNewBankTab();
     // Creates default guild ranks with names in given locale
@@ -70,12 +70,15 @@ class LoginQueryHolder : public CharacterDatabaseQueryHolder
 private:
     uint32 m_accountId;
     ObjectGuid m_guid;
+    TimePoint m_startTime;
 public:
-    LoginQueryHolder(uint32 accountId, ObjectGuid guid)
-        : m_accountId(accountId), m_guid(guid) { }
+    LoginQueryHolder(uint32 accountId, ObjectGuid guid, TimePoint startTime)
+        : m_accountId(accountId), m_guid(guid), m_startTime(startTime) { sWorld->StartLoginLoading(); }
+    ~LoginQueryHolder() override { sWorld->FinishLoginLoading(); }
 
     ObjectGuid GetGuid() const { return m_guid; }
     uint32 GetAccountId() const { return m_accountId; }
+    TimePoint GetStartTime() const { return m_startTime; }
     bool Initialize();
 };
 
@@ -83,6 +86,9 @@ bool LoginQueryHolder::Initialize()
 {
     SetSize(MAX_PLAYER_LOGIN_QUERY);
 
+    // All login queries are plain selects, send them in one round trip
+    SetBatched(true);
+
     bool res = true;
     ObjectGuid::LowType lowGuid = m_guid.GetCounter();
 
@@ -130,15 +136,6 @@ bool LoginQueryHolder::Initialize()
     stmt->SetData(0, lowGuid);
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_ACTIONS, stmt);
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAIL);
-    stmt->SetData(0, lowGuid);
-    stmt->SetData(1, uint32(GameTime::GetGameTime().count()));
-    res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAILS, stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
-    stmt->SetData(0, lowGuid);
-    res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS, stmt);
-
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SOCIALLIST);
     stmt->SetData(0, lowGuid);
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST, stmt);
@@ -667,6 +664,11 @@ void WorldSession::HandleCharDeleteOpcode(WorldPacket& recvData)
 void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
 {
     m_playerLoading = true;
+
+    // login admission may have held this request back for a while
+    TimePoint loginRequestTime = _loginRequestTime != TimePoint() ? _loginRequestTime : std::chrono::steady_clock::now();
+    _loginRequestTime = TimePoint();
+
     ObjectGuid playerGuid;
     recvData >> playerGuid;
 
@@ -777,7 +779,7 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         }
     }
 
-    std::shared_ptr<LoginQueryHolder> holder = std::make_shared<LoginQueryHolder>(GetAccountId(), playerGuid);
+    std::shared_ptr<LoginQueryHolder> holder = std::make_shared<LoginQueryHolder>(GetAccountId(), playerGuid, loginRequestTime);
     if (!holder->Initialize())
     {
         m_playerLoading = false;
@@ -819,6 +821,11 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
     data << pCurrChar->GetOrientation();
     SendPacket(&data);
 
+    // Time from CMSG_PLAYER_LOGIN (including login admission) to SMSG_LOGIN_VERIFY_WORLD, logins per second are the count of this metric
+    auto const loginTime = std::chrono::steady_clock::now() - holder.GetStartTime();
+    LOG_DEBUG("network", "Player {} loaded from DB in {} us", pCurrChar->GetGUID().ToString(), std::chrono::duration_cast<Microseconds>(loginTime).count());
+    METRIC_VALUE("player_login_time", loginTime);
+
     // load player specific part before send times
     LoadAccountData(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_ACCOUNT_DATA), PER_CHARACTER_CACHE_MASK);
     SendAccountDataTimes(PER_CHARACTER_CACHE_MASK);
@@ -1054,6 +1061,9 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
 
     m_playerLoading = false;
 
+    sWorld->AddTimeToInWorld(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - holder.GetStartTime()));
+    sWorld->RemoveLoginPriority(GetAccountId());
+
     // Handle Auth-Achievements (should be handled after loading)
     _player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_ON_LOGIN, 1);
 
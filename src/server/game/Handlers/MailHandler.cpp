@@ -34,12 +34,40 @@
 #include "ObjectMgr.h"
 #include "Opcodes.h"
 #include "Player.h"
+#include "QueryHolder.h"
 #include "ScriptMgr.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
 
 constexpr uint32 MAX_INBOX_CLIENT_CAPACITY = 50;
 constexpr uint32 MAX_NETCLIENT_PACKET_SIZE = 32767 - 1; // Client hardcap: int16 with trailing zero space otherwise crash on memory free
+constexpr Seconds MAIL_LIST_CACHE_TIME = 60s;           // keeps the expiration time shown by the client fresh
+
+class MailBoxQueryHolder : public CharacterDatabaseQueryHolder
+{
+public:
+    enum
+    {
+        MAILS,
+        MAIL_ITEMS,
+
+        MAX
+    };
+
+    MailBoxQueryHolder(ObjectGuid::LowType playerGuid)
+    {
+        SetSize(MAX);
+        SetBatched(true);
+
+        CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAIL);
+        stmt->SetData(0, playerGuid);
+        SetPreparedQuery(MAILS, stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
+        stmt->SetData(0, playerGuid);
+        SetPreparedQuery(MAIL_ITEMS, stmt);
+    }
+};
 
 bool WorldSession::CanOpenMailBox(ObjectGuid guid)
 {
@@ -184,7 +212,12 @@ void WorldSession::HandleSendMail(WorldPacket& recvData)
     if (receive)
     {
         rc_teamId = receive->GetTeamId();
-        mails_count = receive->GetMailSize();
+
+        // mails of an online receiver are only all in memory once the mailbox was opened
+        if (receive->IsMailBoxLoaded())
+            mails_count = receive->GetMailSize();
+        else if (CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(receiverGuid))
+            mails_count = playerData->MailCount;
     }
     else
     {
@@ -361,7 +394,7 @@ void WorldSession::HandleMailMarkAsRead(WorldPacket& recvData)
         if (player->unReadMails)
             --player->unReadMails;
         m->checked = m->checked | MAIL_CHECK_MASK_READ;
-        player->m_mailsUpdated = true;
+        player->SetMailsUpdated();
         m->state = MAIL_STATE_CHANGED;
     }
 }
@@ -380,7 +413,7 @@ void WorldSession::HandleMailDelete(WorldPacket& recvData)
 
     Mail* m = _player->GetMail(mailId);
     Player* player = _player;
-    player->m_mailsUpdated = true;
+    player->SetMailsUpdated();
     if (m)
     {
         // delete shouldn't show up for COD mails
@@ -550,7 +583,7 @@ void WorldSession::HandleMailTakeItem(WorldPacket& recvData)
 
         m->COD = 0;
         m->state = MAIL_STATE_CHANGED;
-        player->m_mailsUpdated = true;
+        player->SetMailsUpdated();
         player->RemoveMItem(it->GetGUID().GetCounter());
 
         uint32 count = it->GetCount();                      // save counts before store and possible merge with deleting
@@ -594,7 +627,7 @@ void WorldSession::HandleMailTakeMoney(WorldPacket& recvData)
 
     m->money = 0;
     m->state = MAIL_STATE_CHANGED;
-    player->m_mailsUpdated = true;
+    player->SetMailsUpdated();
 
     player->SendMailResult(mailId, MAIL_MONEY_TAKEN, MAIL_OK);
 
@@ -614,8 +647,27 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
     if (!CanOpenMailBox(mailbox))
         return;
 
+    if (!_player->IsMailBoxLoaded())
+    {
+        _mailListRequest = mailbox;
+        LoadMailBox();
+        return;
+    }
+
+    SendMailList();
+}
+
+void WorldSession::SendMailList()
+{
     Player* player = _player;
 
+    // nothing changed since the last open, the list and the unread mails are still the same
+    if (WorldPacket const* mailList = player->GetMailListPacket())
+    {
+        SendPacket(mailList);
+        return;
+    }
+
     uint8 mailsCount = 0;
     uint32 realCount = 0;
 
@@ -623,9 +675,19 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
     data << uint32(0);                                      // real mail's count
     data << uint8(0);                                       // mail's count
     time_t cur_time = GameTime::GetGameTime().count();
+    time_t validUntil = cur_time + MAIL_LIST_CACHE_TIME.count();
 
     for (Mail const* mail : player->GetMails())
     {
+        // the list changes when a mail is delivered or expires
+        if (mail->state != MAIL_STATE_DELETED)
+        {
+            if (cur_time < mail->deliver_time)
+                validUntil = std::min(validUntil, mail->deliver_time);
+            else if (cur_time <= mail->expire_time)
+                validUntil = std::min(validUntil, mail->expire_time + 1);
+        }
+
         // prevent client storage overflow
         if (mailsCount >= MAX_INBOX_CLIENT_CAPACITY)
         {
@@ -729,6 +791,8 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
     data.put<uint8>(4, mailsCount);     // set real send mails to client
     SendPacket(&data);
 
+    player->SetMailListPacket(std::move(data), validUntil);
+
     // recalculate m_nextMailDelivereTime and unReadMails
     _player->UpdateNextMailTimeAndUnreads();
 }
@@ -788,7 +852,7 @@ void WorldSession::HandleMailCreateTextItem(WorldPacket& recvData)
     {
         m->checked = m->checked | MAIL_CHECK_MASK_COPIED;
         m->state = MAIL_STATE_CHANGED;
-        player->m_mailsUpdated = true;
+        player->SetMailsUpdated();
 
         player->StoreItem(dest, bodyItem, true);
         player->SendMailResult(mailId, MAIL_MADE_PERMANENT, MAIL_OK);
@@ -800,8 +864,21 @@ void WorldSession::HandleMailCreateTextItem(WorldPacket& recvData)
     }
 }
 
-//TODO Fix me! ... this void has probably bad condition, but good data are sent
 void WorldSession::HandleQueryNextMailTime(WorldPacket& /*recvData*/)
+{
+    // the senders of unread mails are only known once the mails are loaded
+    if (_player->unReadMails > 0 && !_player->IsMailBoxLoaded())
+    {
+        _nextMailTimeRequested = true;
+        LoadMailBox();
+        return;
+    }
+
+    SendQueryNextMailTime();
+}
+
+//TODO Fix me! ... this void has probably bad condition, but good data are sent
+void WorldSession::SendQueryNextMailTime()
 {
     WorldPacket data(MSG_QUERY_NEXT_MAIL_TIME, 8);
 
@@ -849,3 +926,43 @@ void WorldSession::HandleQueryNextMailTime(WorldPacket& /*recvData*/)
 
     SendPacket(&data);
 }
+
+// Mails are read on the first mailbox use, requests arriving meanwhile are answered once they are in memory
+void WorldSession::LoadMailBox()
+{
+    if (_mailBoxLoading)
+        return;
+
+    _mailBoxLoading = true;
+
+    ObjectGuid playerGuid = _player->GetGUID();
+
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(std::make_shared<MailBoxQueryHolder>(playerGuid.GetCounter())))
+        .AfterComplete([this, playerGuid](SQLQueryHolderBase const& holder)
+    {
+        _mailBoxLoading = false;
+
+        // the player logged out meanwhile, the next character of the session loads its own mails
+        if (!_player || _player->GetGUID() != playerGuid)
+        {
+            if (!_player)
+            {
+                _mailListRequest.Clear();
+                _nextMailTimeRequested = false;
+            }
+            else if (_mailListRequest || _nextMailTimeRequested)
+                LoadMailBox();
+
+            return;
+        }
+
+        _player->LoadMailBox(holder.GetPreparedResult(MailBoxQueryHolder::MAILS), holder.GetPreparedResult(MailBoxQueryHolder::MAIL_ITEMS));
+
+        ObjectGuid mailbox = std::exchange(_mailListRequest, ObjectGuid::Empty);
+        if (mailbox && CanOpenMailBox(mailbox))
+            SendMailList();
+
+        if (std::exchange(_nextMailTimeRequested, false))
+            SendQueryNextMailTime();
+    });
+}
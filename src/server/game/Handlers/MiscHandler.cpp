@@ -220,29 +220,27 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
 
     uint32 matchCount = 0;
 
-    uint32 levelMin, levelMax, racemask, classmask, zonesCount, strCount;
-    std::array<uint32, 10> zoneids = {};                    // 10 is client limit
+    WhoListQuery query;
+    uint32 strCount;
     std::string packetPlayerName, packetGuildName;
 
-    recvData >> levelMin;                                   // maximal player level, default 0
-    recvData >> levelMax;                                   // minimal player level, default 100 (MAX_LEVEL)
+    recvData >> query.LevelMin;                             // maximal player level, default 0
+    recvData >> query.LevelMax;                             // minimal player level, default 100 (MAX_LEVEL)
     recvData >> packetPlayerName;                           // player name, case sensitive...
 
     recvData >> packetGuildName;                            // guild name, case sensitive...
 
-    recvData >> racemask;                                   // race mask
-    recvData >> classmask;                                  // class mask
-    recvData >> zonesCount;                                 // zones count, client limit = 10 (2.0.10)
+    recvData >> query.RaceMask;                             // race mask
+    recvData >> query.ClassMask;                            // class mask
+    recvData >> query.ZonesCount;                           // zones count, client limit = 10 (2.0.10)
 
-    if (zonesCount > 10)
+    if (query.ZonesCount > query.Zones.size())
         return;                                             // can't be received from real client or broken packet
 
-    for (uint32 i = 0; i < zonesCount; ++i)
+    for (uint32 i = 0; i < query.ZonesCount; ++i)
     {
-        uint32 temp;
-        recvData >> temp;                                   // zone id, 0 if zone is unknown...
-        zoneids[i] = temp;
-        LOG_DEBUG("network.who", "Zone {}: {}", i, zoneids[i]);
+        recvData >> query.Zones[i];                         // zone id, 0 if zone is unknown...
+        LOG_DEBUG("network.who", "Zone {}: {}", i, query.Zones[i]);
     }
 
     recvData >> strCount;                                   // user entered strings count, client limit=4 (checked on 2.0.10)
@@ -251,7 +249,7 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
         return;                                             // can't be received from real client or broken packet
 
     LOG_DEBUG("network.who", "Minlvl {}, maxlvl {}, name {}, guild {}, racemask {}, classmask {}, zones {}, strings {}",
-        levelMin, levelMax, packetPlayerName, packetGuildName, racemask, classmask, zonesCount, strCount);
+        query.LevelMin, query.LevelMax, packetPlayerName, packetGuildName, query.RaceMask, query.ClassMask, query.ZonesCount, strCount);
 
     std::wstring str[4];                                    // 4 is client limit
     for (uint32 i = 0; i < strCount; ++i)
@@ -277,33 +275,35 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
 
     // client send in case not set max level value 100 but Warhead supports 255 max level,
     // update it to show GMs with characters after 100 level
-    if (levelMax >= MAX_LEVEL)
-        levelMax = STRONG_MAX_LEVEL;
+    if (query.LevelMax >= MAX_LEVEL)
+        query.LevelMax = STRONG_MAX_LEVEL;
 
     uint32 team = _player->GetTeamId();
     uint32 security = GetSecurity();
     bool allowTwoSideWhoList = CONF_GET_BOOL("AllowTwoSide.WhoList");
     uint32 gmLevelInWhoList = CONF_GET_INT("GM.InWhoList.Level");
+    uint32 maxWhoListReturns = CONF_GET_UINT("MaxWhoListReturns");
     uint32 displaycount = 0;
 
     WorldPacket data(SMSG_WHO, 50);     // guess size
     data << uint32(matchCount);         // placeholder, count of players matching criteria
     data << uint32(displaycount);       // placeholder, count of players displayed
 
-    for (auto const& target : sWhoListCacheMgr->GetWhoList())
+    // level, class, race and zone are already matched by the cache
+    sWhoListCacheMgr->VisitMatches(query, [&](WhoListPlayerInfo const& target)
     {
         if (AccountMgr::IsPlayerAccount(security))
         {
             // player can see member of other team only if CONFIG_ALLOW_TWO_SIDE_WHO_LIST
             if (target.GetTeamId() != team && !allowTwoSideWhoList)
             {
-                continue;
+                return;
             }
 
             // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
             if (target.GetSecurity() > AccountTypes(gmLevelInWhoList))
             {
-                continue;
+                return;
             }
         }
 
@@ -311,62 +311,23 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
         if ((_player->GetGUID() != target.GetGuid() && !target.IsVisible()) &&
             (AccountMgr::IsPlayerAccount(_player->GetSession()->GetSecurity()) || target.GetSecurity() > _player->GetSession()->GetSecurity()))
         {
-            continue;
-        }
-
-        // check if target's level is in level range
-        uint8 lvl = target.GetLevel();
-        if (lvl < levelMin || lvl > levelMax)
-        {
-            continue;
-        }
-
-        // check if class matches classmask
-        uint8 class_ = target.GetClass();
-        if (!(classmask & (1 << class_)))
-        {
-            continue;
-        }
-
-        // check if race matches racemask
-        uint32 race = target.GetRace();
-        if (!(racemask & (1 << race)))
-        {
-            continue;
-        }
-
-        uint32 playerZoneId = target.GetZoneId();
-        uint8 gender = target.GetGender();
-
-        bool showZones = true;
-        for (uint32 i = 0; i < zonesCount; ++i)
-        {
-            if (zoneids[i] == playerZoneId)
-            {
-                showZones = true;
-                break;
-            }
-
-            showZones = false;
-        }
-
-        if (!showZones)
-        {
-            continue;
+            return;
         }
 
         std::wstring const& wideplayername = target.GetWidePlayerName();
         if (!(wpacketPlayerName.empty() || wideplayername.find(wpacketPlayerName) != std::wstring::npos))
         {
-            continue;
+            return;
         }
 
         std::wstring const& wideguildname = target.GetWideGuildName();
         if (!(wpacketGuildName.empty() || wideguildname.find(wpacketGuildName) != std::wstring::npos))
         {
-            continue;
+            return;
         }
 
+        uint32 playerZoneId = target.GetZoneId();
+
         std::string aname;
         if (AreaTableEntry const* areaEntry = sAreaTableStore.LookupEntry(playerZoneId))
         {
@@ -392,24 +353,24 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
 
         if (!s_show)
         {
-            continue;
+            return;
         }
 
         // 49 is maximum player count sent to client - can be overridden
         // through config, but is unstable
-        if ((matchCount++) >= CONF_GET_UINT("MaxWhoListReturns"))
-            continue;
+        if ((matchCount++) >= maxWhoListReturns)
+            return;
 
         data << target.GetPlayerName();                   // player name
         data << target.GetGuildName();                    // guild name
-        data << uint32(lvl);                              // player level
-        data << uint32(class_);                           // player class
-        data << uint32(race);                             // player race
-        data << uint8(gender);                            // player gender
+        data << uint32(target.GetLevel());                // player level
+        data << uint32(target.GetClass());                // player class
+        data << uint32(target.GetRace());                 // player race
+        data << uint8(target.GetGender());                // player gender
         data << uint32(playerZoneId);                     // player zone id
 
         ++displaycount;
-    }
+    });
 
     data.put(0, displaycount);                            // insert right count, count displayed
     data.put(4, matchCount);                              // insert right count, count of matches
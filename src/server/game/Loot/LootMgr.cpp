@@ -19,6 +19,7 @@
 // PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
 
 #include "LootMgr.h"
+#include "AliasTable.h"
 #include "Containers.h"
 #include "DatabaseEnv.h"
 #include "GameConfig.h"
@@ -116,11 +117,22 @@ public:
     LootStoreItemList* GetExplicitlyChancedItemList() { return &ExplicitlyChanced; }
     LootStoreItemList* GetEqualChancedItemList() { return &EqualChanced; }
     void CopyConditions(ConditionList conditions);
+    void Compile();
+    LootStoreItem const* Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const;   // Rolls an item from the group, returns nullptr if all miss their chances
 private:
     LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
     LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
 
-    LootStoreItem const* Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const;   // Rolls an item from the group, returns nullptr if all miss their chances
+    // Compiled form of the roll, usable as long as no entry would be filtered out and no script can change chances
+    std::vector<LootStoreItem*> CompiledExplicitlyChanced;
+    std::vector<LootStoreItem*> CompiledEqualChanced;
+    Warhead::AliasTable ExplicitRoll;                   // outcomes: CompiledExplicitlyChanced, then one for falling through to equal chanced
+    uint16 CommonLootMode{ 0 };                         // loot mode bits every entry has
+    uint8 GroupId{ 0 };
+    bool IsCompiled{ false };
+
+    bool CanUseCompiledRoll(Loot const& loot, uint16 lootMode) const;
+    LootStoreItem const* CompiledRoll() const;
 
     // This class must never be copied - storing pointers
     LootGroup(LootGroup const&);
@@ -214,6 +226,9 @@ uint32 LootStore::LoadLootTable()
         ++count;
     } while (result->NextRow());
 
+    for (auto const& [lootId, lootTemplate] : m_LootTemplates)
+        lootTemplate->CompileGroups();
+
     Verify();                                           // Checks validity of the loot store
 
     return count;
@@ -322,7 +337,19 @@ bool LootStoreItem::Roll(bool rate, Player const* player, Loot& loot, LootStore
 
     ItemTemplate const* pProto = sObjectMgr->GetItemTemplate(itemid);
 
-    float qualityModifier = pProto && rate ? CONF_GET_FLOAT(qualityToRate[pProto->Quality]) : 1.0f;
+    static GameConfigOption<float> const qualityRates[MAX_ITEM_QUALITY] =
+    {
+        GameConfigOption<float>(qualityToRate[ITEM_QUALITY_POOR]),
+        GameConfigOption<float>(qualityToRate[ITEM_QUALITY_NORMAL]),
+        GameConfigOption<float>(qualityToRate[ITEM_QUALITY_UNCOMMON]),
+        GameConfigOption<float>(qualityToRate[ITEM_QUALITY_RARE]),
+        GameConfigOption<float>(qualityToRate[ITEM_QUALITY_EPIC]),
+        GameConfigOption<float>(qualityToRate[ITEM_QUALITY_LEGENDARY]),
+        GameConfigOption<float>(qualityToRate[ITEM_QUALITY_ARTIFACT]),
+        GameConfigOption<float>(qualityToRate[ITEM_QUALITY_HEIRLOOM])
+    };
+
+    float qualityModifier = pProto && rate ? qualityRates[pProto->Quality].Get() : 1.0f;
 
     return roll_chance_f(_chance * qualityModifier);
 }
@@ -1261,9 +1288,90 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
         EqualChanced.push_back(item);
 }
 
+// Builds the alias table for the group, the outcome probabilities are the same as the sequential roll below gives
+void LootTemplate::LootGroup::Compile()
+{
+    IsCompiled = false;
+    CompiledExplicitlyChanced.assign(ExplicitlyChanced.begin(), ExplicitlyChanced.end());
+    CompiledEqualChanced.assign(EqualChanced.begin(), EqualChanced.end());
+    ExplicitRoll = Warhead::AliasTable();
+    CommonLootMode = 0xFFFF;
+
+    for (LootStoreItemList const* list : { &ExplicitlyChanced, &EqualChanced })
+    {
+        for (LootStoreItem const* item : *list)
+        {
+            // entries without template are always filtered out, keep the sequential roll for them
+            if (!item->reference && !sObjectMgr->GetItemTemplate(item->itemid))
+                return;
+
+            CommonLootMode &= item->lootmode;
+            GroupId = item->groupid;
+        }
+    }
+
+    if (!CommonLootMode)
+        return;
+
+    if (!CompiledExplicitlyChanced.empty())
+    {
+        // sequential roll: one number in [0, 100), every entry takes its chance from what is left
+        std::vector<double> weights;
+        weights.reserve(CompiledExplicitlyChanced.size() + 1);
+
+        double left = 100.0;
+        for (LootStoreItem const* item : CompiledExplicitlyChanced)
+        {
+            double weight = item->chance >= 100.0f ? left : std::min<double>(item->chance, left);
+            weights.push_back(weight);
+            left -= weight;
+        }
+
+        weights.push_back(left);
+        ExplicitRoll.Build(weights);
+    }
+
+    IsCompiled = true;
+}
+
+bool LootTemplate::LootGroup::CanUseCompiledRoll(Loot const& loot, uint16 lootMode) const
+{
+    if (!IsCompiled || !(lootMode & CommonLootMode))
+        return false;
+
+    // scripts may change chances or cancel the roll
+    if (sScriptMgr->HasLootRollScripts())
+        return false;
+
+    // duplicates of the group may get filtered out
+    for (LootItem const& item : loot.items)
+        if (item.groupid == GroupId)
+            return false;
+
+    return true;
+}
+
+LootStoreItem const* LootTemplate::LootGroup::CompiledRoll() const
+{
+    if (!ExplicitRoll.empty())
+    {
+        std::size_t outcome = ExplicitRoll.Sample(rand_norm());
+        if (outcome < CompiledExplicitlyChanced.size())
+            return CompiledExplicitlyChanced[outcome];
+    }
+
+    if (CompiledEqualChanced.empty())
+        return nullptr;
+
+    return CompiledEqualChanced[urand(0, CompiledEqualChanced.size() - 1)];
+}
+
 // Rolls an item from the group, returns nullptr if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const
 {
+    if (CanUseCompiledRoll(loot, lootMode))
+        return CompiledRoll();
+
     LootStoreItemList possibleLoot = ExplicitlyChanced;
     possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
 
@@ -1524,7 +1632,22 @@ LootTemplate::~LootTemplate()
     Groups.clear();
 }
 
-// Adds an entry to the group (at loading stage)
+// Compiles the groups once all entries are added (at loading stage)
+void LootTemplate::CompileGroups()
+{
+    for (LootGroup* group : Groups)
+        if (group)
+            group->Compile();
+}
+
+LootStoreItem const* LootTemplate::RollGroup(uint8 groupId, Loot& loot, LootStore const& store, uint16 lootMode, Player const* player) const
+{
+    if (!groupId || groupId > Groups.size() || !Groups[groupId - 1])
+        return nullptr;
+
+    return Groups[groupId - 1]->Roll(loot, player, store, lootMode);
+}
+
 void LootTemplate::AddEntry(LootStoreItem* item)
 {
     // `item->reference` > 0 --> Reference is counted as a normal and non grouped entry
@@ -268,6 +268,11 @@ public:
     bool addConditionItem(Condition* cond);
     [[nodiscard]] bool isReference(uint32 id) const;
 
+    // Prepares the groups for fast rolling, called once all entries are added
+    void CompileGroups();
+    // Rolls one group without adding the result to the loot, returns nullptr for an empty drop
+    LootStoreItem const* RollGroup(uint8 groupId, Loot& loot, LootStore const& store, uint16 lootMode, Player const* player) const;
+
 private:
     LootStoreItemList Entries;                          // not grouped only
     LootGroups        Groups;                           // groups have own (optimised) processing, grouped entries go there
@@ -2477,6 +2477,45 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
     return true;
 }
 
+void Map::isInLineOfSight(Position const* starts, Position const* ends, bool* results, uint32 count, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    if (!CONF_GET_BOOL("vmap.BlizzlikePvPLOS") && IsBattlegroundOrArena())
+        ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+
+    std::fill(results, results + count, true);
+
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+    {
+        std::vector<G3D::Vector3> points1, points2;
+        points1.reserve(count);
+        points2.reserve(count);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            points1.emplace_back(starts[i].GetPositionX(), starts[i].GetPositionY(), starts[i].GetPositionZ());
+            points2.emplace_back(ends[i].GetPositionX(), ends[i].GetPositionY(), ends[i].GetPositionZ());
+        }
+
+        VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSight(GetId(), points1.data(), points2.data(), results, count, ignoreFlags);
+    }
+
+    if (CONF_GET_BOOL("CheckGameObjectLoS") && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
+    {
+        ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        if (!(checks & LINEOFSIGHT_CHECK_GOBJECT_M2))
+        {
+            ignoreFlags = VMAP::ModelIgnoreFlags::M2;
+        }
+
+        for (uint32 i = 0; i < count; ++i)
+        {
+            // segments already blocked by static geometry do not need the dynamic tree
+            if (results[i])
+                results[i] = _dynamicTree.isInLineOfSight(starts[i].GetPositionX(), starts[i].GetPositionY(), starts[i].GetPositionZ(),
+                    ends[i].GetPositionX(), ends[i].GetPositionY(), ends[i].GetPositionZ(), phasemask, ignoreFlags);
+        }
+    }
+}
+
 bool Map::GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 {
     G3D::Vector3 startPos(x1, y1, z1);
@@ -3237,6 +3276,15 @@ void BattlegroundMap::InitVisibilityDistance()
         m_VisibleDistance = 30.0f;
 }
 
+void BattlegroundMap::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
+{
+    Map::Update(t_diff, s_diff);
+
+    // s_diff is the world diff on every tick, Battleground::Update throttles itself
+    if (m_bg)
+        m_bg->Update(s_diff);
+}
+
 Map::EnterState BattlegroundMap::CannotEnter(Player* player, bool loginCheck)
 {
     if (!loginCheck && player->GetMapRef().getTarget() == this)
@@ -67,11 +67,20 @@ void ScriptMgr::OnBeforeDropAddItem(Player const* player, Loot& loot, bool canRa
     });
 }
 
+bool ScriptMgr::HasLootRollScripts() const
+{
+    for (auto const& [scriptID, script] : ScriptRegistry<GlobalScript>::Instance()->GetScripts())
+        if (script->HasLootRollHooks())
+            return true;
+
+    return false;
+}
+
 bool ScriptMgr::OnItemRoll(Player const* player, LootStoreItem const* lootStoreItem, float& chance, Loot& loot, LootStore const& store)
 {
     auto ret = IsValidBoolScript<GlobalScript>([&](GlobalScript* script)
     {
-        return !script->OnItemRoll(player, lootStoreItem, chance, loot, store);
+        return script->HasLootRollHooks() && !script->OnItemRoll(player, lootStoreItem, chance, loot, store);
     });
 
     return ReturnValidBool(ret);
@@ -81,7 +90,7 @@ bool ScriptMgr::OnBeforeLootEqualChanced(Player const* player, std::list<LootSto
 {
     auto ret = IsValidBoolScript<GlobalScript>([&](GlobalScript* script)
     {
-        return !script->OnBeforeLootEqualChanced(player, equalChanced, loot, store);
+        return script->HasLootRollHooks() && !script->OnBeforeLootEqualChanced(player, equalChanced, loot, store);
     });
 
     return ReturnValidBool(ret);
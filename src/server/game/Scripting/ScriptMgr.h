@@ -566,6 +566,8 @@ public: /* GroupScript */
     void OnCreate(Group* group, Player* leader);
 
 public: /* GlobalScript */
+    // True if a GlobalScript may change or cancel loot group rolls (OnItemRoll, OnBeforeLootEqualChanced)
+    [[nodiscard]] bool HasLootRollScripts() const;
     void OnGlobalItemDelFromDB(CharacterDatabaseTransaction trans, ObjectGuid::LowType itemGuid);
     void OnGlobalMirrorImageDisplayItem(Item const* item, uint32& display);
     void OnBeforeUpdateArenaPoints(ArenaTeam* at, std::map<ObjectGuid, uint32>& ap);
@@ -1633,6 +1633,10 @@ public:
 
     // Called when checking if a player can see the creature loot
     virtual bool OnAllowedForPlayerLootCheck(Player const* /*player*/, ObjectGuid /*source*/) { return true; }
+
+    // Scripts overriding OnItemRoll or OnBeforeLootEqualChanced must return true here, both hooks are only called
+    // for such scripts. Loot groups use their precomputed roll while no script does
+    [[nodiscard]] virtual bool HasLootRollHooks() const { return false; }
 };
 
 class WH_GAME_API BGScript : public ScriptObject
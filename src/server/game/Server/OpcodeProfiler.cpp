@@ -0,0 +1,46 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "OpcodeProfiler.h"
+
+OpcodeProfiler* OpcodeProfiler::instance()
+{
+    static OpcodeProfiler instance;
+    return &instance;
+}
+
+void OpcodeProfiler::Reset()
+{
+    for (Warhead::TimingCounter& counter : _handlers)
+        counter.Reset();
+}
+
+void OpcodeProfiler::AddHandlerTime(uint16 opcode, Nanoseconds elapsed)
+{
+    if (opcode < _handlers.size())
+        _handlers[opcode].Add(elapsed);
+}
+
+OpcodeProfilerEntry OpcodeProfiler::GetHandlerStats(uint16 opcode) const
+{
+    return opcode < _handlers.size() ? _handlers[opcode].Get() : OpcodeProfilerEntry();
+}
+
+ClientOpcodeHandler const* OpcodeProfiler::GetHandler(uint16 opcode)
+{
+    return opcode < NUM_OPCODE_HANDLERS ? opcodeTable[static_cast<OpcodeClient>(opcode)] : nullptr;
+}
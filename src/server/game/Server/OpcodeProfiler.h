@@ -0,0 +1,59 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _OPCODE_PROFILER_H_
+#define _OPCODE_PROFILER_H_
+
+#include "Define.h"
+#include "Opcodes.h"
+#include "TimingCounter.h"
+#include <array>
+#include <atomic>
+
+using OpcodeProfilerEntry = Warhead::TimingStats;
+
+// Timings of client opcode handlers, collected from World::UpdateSessions, its parallel phase and all map threads while enabled
+class WH_GAME_API OpcodeProfiler
+{
+public:
+    static OpcodeProfiler* instance();
+
+    [[nodiscard]] bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+    void SetEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+    void Reset();
+
+    void AddHandlerTime(uint16 opcode, Nanoseconds elapsed);
+
+    [[nodiscard]] OpcodeProfilerEntry GetHandlerStats(uint16 opcode) const;
+
+    // Name and processing place of the handler, for reports outside of the game library
+    [[nodiscard]] static ClientOpcodeHandler const* GetHandler(uint16 opcode);
+
+private:
+    OpcodeProfiler() = default;
+    ~OpcodeProfiler() = default;
+
+    OpcodeProfiler(OpcodeProfiler const&) = delete;
+    OpcodeProfiler& operator=(OpcodeProfiler const&) = delete;
+
+    std::atomic<bool> _enabled{ false };
+    std::array<Warhead::TimingCounter, NUM_OPCODE_HANDLERS> _handlers;
+};
+
+#define sOpcodeProfiler OpcodeProfiler::instance()
+
+#endif
@@ -41,6 +41,7 @@
 #include "Metric.h"
 #include "MuteMgr.h"
 #include "ObjectAccessor.h"
+#include "OpcodeProfiler.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "PacketUtilities.h"
@@ -74,7 +75,8 @@ bool MapSessionFilter::Process(WorldPacket* packet)
         return true;
 
     //we do not process thread-unsafe packets
-    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE)
+    //session-local packets are left to World::UpdateSessions() as well, so a session never handles packets in two threads at once
+    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE || opHandle->ProcessingPlace == PROCESS_THREADSAFE_SESSION)
         return false;
 
     Player* player = m_pSession->GetPlayer();
@@ -96,7 +98,8 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
         return true;
 
     //thread-unsafe packets should be processed in World::UpdateSessions()
-    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE)
+    //session-local packets too, if the parallel phase did not get to them
+    if (opHandle->ProcessingPlace == PROCESS_THREADUNSAFE || opHandle->ProcessingPlace == PROCESS_THREADSAFE_SESSION)
         return true;
 
     //no player attached? -> our client! ^^
@@ -108,6 +111,13 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return !player->IsInWorld();
 }
 
+//only session-local packets are processed in the parallel phase of World::UpdateSessions()
+bool ParallelSessionFilter::Process(WorldPacket* packet)
+{
+    ClientOpcodeHandler const* opHandle = opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())];
+    return opHandle->ProcessingPlace == PROCESS_THREADSAFE_SESSION;
+}
+
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldSocket> sock, AccountTypes sec, uint8 expansion, LocaleConstant locale, uint32 recruiter, bool isARecruiter, bool skipQueue, uint32 TotalTime) :
     m_timeOutTime(0),
@@ -134,7 +144,10 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     m_TutorialsChanged(false),
     recruiterId(recruiter),
     isRecruiter(isARecruiter),
+    _hasSessionLocalPackets(false),
     m_currentVendorEntry(0),
+    _mailBoxLoading(false),
+    _nextMailTimeRequested(false),
     _calendarEventCreationCooldown(0),
     _addonMessageReceiveCount(0),
     _timeSyncClockDeltaQueue(6),
@@ -269,10 +282,41 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     m_Socket->SendPacket(*packet);
 }
 
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (packet->GetOpcode() == NULL_OPCODE)
+    {
+        LOG_ERROR("network.opcode", "{} send NULL_OPCODE", GetPlayerInfo());
+        return;
+    }
+
+    if (!m_Socket)
+        return;
+
+    if (!sScriptMgr->CanPacketSend(this, *packet))
+    {
+        return;
+    }
+
+    LOG_TRACE("network.opcode", "S->C: {} {}", GetPlayerInfo(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())));
+    m_Socket->SendPacket(packet);
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
+    // the packet may be processed and deleted as soon as it is queued
+    bool sessionLocal = opcodeTable[static_cast<OpcodeClient>(new_packet->GetOpcode())]->ProcessingPlace == PROCESS_THREADSAFE_SESSION;
+
     _recvQueue.add(new_packet);
+
+    if (sessionLocal)
+        _hasSessionLocalPackets.store(true, std::memory_order_release);
+}
+
+bool WorldSession::TakeSessionLocalPackets()
+{
+    return _hasSessionLocalPackets.load(std::memory_order_relaxed) && _hasSessionLocalPackets.exchange(false, std::memory_order_acquire);
 }
 
 /// Logging helper for unexpected opcodes
@@ -285,7 +329,7 @@ void WorldSession::LogUnexpectedOpcode(WorldPacket* packet, char const* status,
 /// Logging helper for unexpected opcodes
 void WorldSession::LogUnprocessedTail(WorldPacket* packet)
 {
-    if (!sLog->ShouldLog("network.opcode", Warhead::LogLevel::Trace) || packet->rpos() >= packet->wpos())
+    if (!LOG_IS_ENABLED("network.opcode", Warhead::LogLevel::Trace) || packet->rpos() >= packet->wpos())
         return;
 
     LOG_TRACE("network.opcode", "Unprocessed tail data (read stop at {} from {}) Opcode {} from {}",
@@ -308,7 +352,71 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     HandleTeleportTimeout(updater.ProcessUnsafe());
 
+    time_t currentTime = GameTime::GetGameTime().count();
+    auto queueSize{ _recvQueue.size() };
+
+    if (queueSize >= MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE)
+        LOG_WARN("network", "Found potential packet flood from: {}. Queue size: {}", GetPlayerInfo(), queueSize);
+
     ///- Retrieve packets from the receive queue and call the appropriate handlers
+    uint32 processedPackets = ProcessReceivedPackets(updater);
+
+    METRIC_VALUE("processed_packets", processedPackets);
+    METRIC_VALUE("addon_messages", _addonMessageReceiveCount.load());
+    _addonMessageReceiveCount = 0;
+
+    if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
+    {
+        // Send time sync packet every 10s.
+        if (_timeSyncTimer > 0)
+        {
+            if (diff >= _timeSyncTimer)
+            {
+                SendTimeSync();
+            }
+            else
+            {
+                _timeSyncTimer -= diff;
+            }
+        }
+    }
+
+    ProcessQueryCallbacks();
+
+    //check if we are safe to proceed with logout
+    //logout procedure should happen only in World::UpdateSessions() method!!!
+    if (updater.ProcessUnsafe())
+    {
+        if (m_Socket && m_Socket->IsOpen() && _warden)
+        {
+            _warden->Update(diff);
+        }
+
+        if (ShouldLogOut(currentTime) && !m_playerLoading)
+        {
+            LogoutPlayer(true);
+        }
+
+        if (m_Socket && !m_Socket->IsOpen())
+        {
+            if (GetPlayer() && _warden)
+                _warden->Update(diff);
+
+            m_Socket = nullptr;
+        }
+
+        if (!m_Socket)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Retrieve packets accepted by the filter from the receive queue and call the appropriate handlers, returns the number of processed packets
+uint32 WorldSession::ProcessReceivedPackets(PacketFilter& updater)
+{
     /// not process packets if socket already closed
     WorldPacket* packet = nullptr;
 
@@ -317,10 +425,6 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     std::vector<WorldPacket*> requeuePackets;
     uint32 processedPackets = 0;
     time_t currentTime = GameTime::GetGameTime().count();
-    auto queueSize{ _recvQueue.size() };
-
-    if (queueSize >= MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE)
-        LOG_WARN("network", "Found potential packet flood from: {}. Queue size: {}", GetPlayerInfo(), queueSize);
 
     while (m_Socket && _recvQueue.next(packet, updater))
     {
@@ -359,8 +463,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         break;
                     }
 
-                    opHandle->Call(this, *packet);
-                    LogUnprocessedTail(packet);
+                    CallOpcodeHandler(opHandle, *packet);
                 }
                 else
                     processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -373,8 +476,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         break;
                     }
 
-                    opHandle->Call(this, *packet);
-                    LogUnprocessedTail(packet);
+                    CallOpcodeHandler(opHandle, *packet);
                 }
                 else
                     processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -383,6 +485,18 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                 if (m_inQueue) // prevent cheating
                     break;
 
+                // characters database is overloaded, keep the login request for a later update
+                if (opcode == CMSG_PLAYER_LOGIN && !m_playerLoading && !sWorld->CanStartLoginLoading(GetAccountId()))
+                {
+                    if (_loginRequestTime == TimePoint())
+                        _loginRequestTime = std::chrono::steady_clock::now();
+
+                    requeuePackets.push_back(packet);
+                    deletePacket = false;
+                    processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // keep the packets behind it in order
+                    break;
+                }
+
                 if (AntiDOS.EvaluateOpcode(*packet, currentTime))
                 {
                     if (!sScriptMgr->CanPacketReceive(this, *packet))
@@ -390,8 +504,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                         break;
                     }
 
-                    opHandle->Call(this, *packet);
-                    LogUnprocessedTail(packet);
+                    CallOpcodeHandler(opHandle, *packet);
                 }
                 else
                     processedPackets = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;   // break out of packet processing loop
@@ -434,7 +547,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         catch (ByteBufferException const&)
         {
             LOG_ERROR("network", "WorldSession::Update ByteBufferException occured while parsing a packet (opcode: {}) from client {}, accountid={}. Skipped packet.", packet->GetOpcode(), GetRemoteAddress(), GetAccountId());
-            if (sLog->ShouldLog("network", Warhead::LogLevel::Debug))
+            if (LOG_IS_ENABLED("network", Warhead::LogLevel::Debug))
             {
                 LOG_DEBUG("network", "Dumping error causing packet:");
                 packet->hexlike();
@@ -454,57 +567,21 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
 
-    METRIC_VALUE("processed_packets", processedPackets);
-    METRIC_VALUE("addon_messages", _addonMessageReceiveCount.load());
-    _addonMessageReceiveCount = 0;
-
-    if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
-    {
-        // Send time sync packet every 10s.
-        if (_timeSyncTimer > 0)
-        {
-            if (diff >= _timeSyncTimer)
-            {
-                SendTimeSync();
-            }
-            else
-            {
-                _timeSyncTimer -= diff;
-            }
-        }
-    }
-
-    ProcessQueryCallbacks();
+    return processedPackets;
+}
 
-    //check if we are safe to proceed with logout
-    //logout procedure should happen only in World::UpdateSessions() method!!!
-    if (updater.ProcessUnsafe())
+void WorldSession::CallOpcodeHandler(ClientOpcodeHandler const* opHandle, WorldPacket& packet)
+{
+    if (sOpcodeProfiler->IsEnabled())
     {
-        if (m_Socket && m_Socket->IsOpen() && _warden)
-        {
-            _warden->Update(diff);
-        }
-
-        if (ShouldLogOut(currentTime) && !m_playerLoading)
-        {
-            LogoutPlayer(true);
-        }
-
-        if (m_Socket && !m_Socket->IsOpen())
-        {
-            if (GetPlayer() && _warden)
-                _warden->Update(diff);
-
-            m_Socket = nullptr;
-        }
-
-        if (!m_Socket)
-        {
-            return false;
-        }
+        auto start = std::chrono::steady_clock::now();
+        opHandle->Call(this, packet);
+        sOpcodeProfiler->AddHandlerTime(packet.GetOpcode(), std::chrono::steady_clock::now() - start);
     }
+    else
+        opHandle->Call(this, packet);
 
-    return true;
+    LogUnprocessedTail(&packet);
 }
 
 bool WorldSession::HandleSocketClosed()
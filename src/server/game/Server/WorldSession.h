@@ -31,9 +31,11 @@
 #include "Packet.h"
 #include "SharedDefines.h"
 #include "World.h"
+#include <atomic>
 #include <map>
 #include <utility>
 
+class ClientOpcodeHandler;
 class Creature;
 class GameObject;
 class InstanceSave;
@@ -259,6 +261,18 @@ public:
     bool Process(WorldPacket* packet) override;
 };
 
+//class used to filter only session-local packets from queue
+//used by the parallel phase of World::UpdateSessions(), stops at the first packet that has to wait for the serial phase
+class WH_GAME_API ParallelSessionFilter : public PacketFilter
+{
+public:
+    explicit ParallelSessionFilter(WorldSession* pSession) : PacketFilter(pSession) {}
+    ~ParallelSessionFilter() override = default;
+
+    bool Process(WorldPacket* packet) override;
+    [[nodiscard]] bool ProcessUnsafe() const override { return false; }
+};
+
 // Proxy structure to contain data passed to callback function,
 // only to prevent bloating the parameter list
 class WH_GAME_API CharacterCreateInfo
@@ -340,6 +354,7 @@ public:
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
     void SendPacket(WorldPacket const* packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);  // packet built once and sent to many sessions, the buffer is not copied
 
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
@@ -401,6 +416,10 @@ public:
 
     void QueuePacket(WorldPacket* new_packet);
     bool Update(uint32 diff, PacketFilter& updater);
+    uint32 ProcessReceivedPackets(PacketFilter& updater);
+
+    // True if a session-local packet was queued since the last call, lets the parallel phase skip idle sessions
+    bool TakeSessionLocalPackets();
 
     /// Handle the authentication waiting queue (to be completed)
     void SendAuthWaitQueue(uint32 position);
@@ -768,6 +787,10 @@ public:                                                 // opcodes handlers
     void HandleItemTextQuery(WorldPacket& recvData);
     void HandleMailCreateTextItem(WorldPacket& recvData);
     void HandleQueryNextMailTime(WorldPacket& recvData);
+    void SendMailList();
+    void SendQueryNextMailTime();
+    void LoadMailBox();
+    [[nodiscard]] bool IsMailBoxLoading() const { return _mailBoxLoading; }
     void HandleCancelChanneling(WorldPacket& recvData);
 
     void HandleSplitItemOpcode(WorldPacket& recvPacket);
@@ -1118,6 +1141,8 @@ private:
     void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char* reason);
     void LogUnprocessedTail(WorldPacket* packet);
 
+    void CallOpcodeHandler(ClientOpcodeHandler const* opHandle, WorldPacket& packet);
+
     // EnumData helpers
     bool IsLegitCharacterForAccount(ObjectGuid guid)
     {
@@ -1148,6 +1173,7 @@ private:
     time_t _logoutTime;
     bool m_inQueue;                                     // session wait in auth.queue
     bool m_playerLoading;                               // code processed in LoginPlayer
+    TimePoint _loginRequestTime;                        // first CMSG_PLAYER_LOGIN of the current login, including time held back by login admission
     bool m_playerLogout;                                // code processed in LogoutPlayer
     bool m_playerSave;
     LocaleConstant m_sessionDbcLocale;
@@ -1160,8 +1186,13 @@ private:
     uint32 recruiterId;
     bool isRecruiter;
     LockedQueue<WorldPacket*> _recvQueue;
+    std::atomic<bool> _hasSessionLocalPackets;
     uint32 m_currentVendorEntry;
     ObjectGuid m_currentBankerGUID;
+    // Mailbox requests answered once the first load of the player's mails is done
+    bool _mailBoxLoading;
+    ObjectGuid _mailListRequest;
+    bool _nextMailTimeRequested;
     uint32 _offlineTime;
     bool _kicked;
     bool _shouldSetOfflineInDB;
@@ -0,0 +1,117 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldSessionUpdater.h"
+#include "DatabaseEnv.h"
+#include "WorldSession.h"
+#include <algorithm>
+
+namespace
+{
+    // Sessions handed to a worker at once, most of them have no session-local packet queued
+    constexpr std::size_t SESSIONS_PER_BATCH = 32;
+}
+
+WorldSessionUpdater::~WorldSessionUpdater()
+{
+    if (IsActive())
+        Deactivate();
+}
+
+void WorldSessionUpdater::Activate(std::size_t numThreads)
+{
+    _workerThreads.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; ++i)
+        _workerThreads.emplace_back(&WorldSessionUpdater::WorkerThread, this);
+}
+
+void WorldSessionUpdater::Deactivate()
+{
+    _cancelationToken = true;
+
+    _queue.Cancel();
+
+    for (auto& thread : _workerThreads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+
+    _workerThreads.clear();
+}
+
+void WorldSessionUpdater::ProcessSessionPackets(std::vector<WorldSession*> const& sessions)
+{
+    if (sessions.empty())
+        return;
+
+    WorldSession* const* sessionData = sessions.data();
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        for (std::size_t i = 0; i < sessions.size(); i += SESSIONS_PER_BATCH)
+        {
+            ++_pendingBatches;
+            _queue.Push({ sessionData + i, sessionData + std::min(i + SESSIONS_PER_BATCH, sessions.size()) });
+        }
+    }
+
+    // the world thread takes its share of the work instead of idling
+    SessionBatch batch;
+    while (_queue.Pop(batch))
+        ProcessBatch(batch);
+
+    std::unique_lock<std::mutex> guard(_lock);
+
+    while (_pendingBatches > 0)
+        _condition.wait(guard);
+}
+
+void WorldSessionUpdater::ProcessBatch(SessionBatch const& batch)
+{
+    for (WorldSession* const* itr = batch.Begin; itr != batch.End; ++itr)
+    {
+        ParallelSessionFilter updater(*itr);
+        (*itr)->ProcessReceivedPackets(updater);
+    }
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    --_pendingBatches;
+
+    _condition.notify_all();
+}
+
+void WorldSessionUpdater::WorkerThread()
+{
+    AuthDatabase.WarnAboutSyncQueries(true);
+    CharacterDatabase.WarnAboutSyncQueries(true);
+    WorldDatabase.WarnAboutSyncQueries(true);
+
+    while (true)
+    {
+        SessionBatch batch;
+
+        _queue.WaitAndPop(batch);
+        if (_cancelationToken)
+            return;
+
+        if (batch.Begin)
+            ProcessBatch(batch);
+    }
+}
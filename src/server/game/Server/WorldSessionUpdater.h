@@ -0,0 +1,65 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLD_SESSION_UPDATER_H_
+#define _WORLD_SESSION_UPDATER_H_
+
+#include "Define.h"
+#include "PCQueue.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorldSession;
+
+// Worker pool of the parallel phase of World::UpdateSessions: processes the session-local (PROCESS_THREADSAFE_SESSION)
+// packets at the head of each session's receive queue. Nothing else may run on the world thread meanwhile.
+class WH_GAME_API WorldSessionUpdater
+{
+public:
+    WorldSessionUpdater() = default;
+    ~WorldSessionUpdater();
+
+    void Activate(std::size_t numThreads);
+    void Deactivate();
+    [[nodiscard]] bool IsActive() const { return !_workerThreads.empty(); }
+
+    // Returns when the session-local packets of all given sessions are processed
+    void ProcessSessionPackets(std::vector<WorldSession*> const& sessions);
+
+private:
+    struct SessionBatch
+    {
+        WorldSession* const* Begin{ nullptr };
+        WorldSession* const* End{ nullptr };
+    };
+
+    void WorkerThread();
+    void ProcessBatch(SessionBatch const& batch);
+
+    ProducerConsumerQueue<SessionBatch> _queue;
+
+    std::vector<std::thread> _workerThreads;
+    std::atomic<bool> _cancelationToken{ false };
+
+    std::mutex _lock;
+    std::condition_variable _condition;
+    std::size_t _pendingBatches{ 0 };
+};
+
+#endif
@@ -37,11 +37,19 @@ public:
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    // references a packet broadcast to many sockets instead of copying it
+    EncryptablePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : WorldPacket(packet->GetOpcode(), 0), _shared(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
     bool NeedsEncryption() const { return _encrypt; }
+    WorldPacket const& GetPacket() const { return _shared ? *_shared : *this; }
 
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    std::shared_ptr<WorldPacket const> _shared;
     bool _encrypt;
 };
 
@@ -79,6 +87,7 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
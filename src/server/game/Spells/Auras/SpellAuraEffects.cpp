@@ -36,6 +36,7 @@
 #include "ScriptMgr.h"
 #include "Spell.h"
 #include "SpellMgr.h"
+#include "SpellProfiler.h"
 #include "Unit.h"
 #include "Util.h"
 #include "Vehicle.h"
@@ -772,7 +773,14 @@ void AuraEffect::HandleEffect(AuraApplication* aurApp, uint8 mode, bool apply)
     if ((apply && aurApp->GetRemoveMode()) || prevented)
         return;
 
-    (*this.*AuraEffectHandler [GetAuraType()])(aurApp, mode, apply);
+    if (sSpellProfiler->IsEnabled())
+    {
+        auto start = std::chrono::steady_clock::now();
+        (*this.*AuraEffectHandler [GetAuraType()])(aurApp, mode, apply);
+        sSpellProfiler->AddAuraEffectTime(GetAuraType(), std::chrono::steady_clock::now() - start);
+    }
+    else
+        (*this.*AuraEffectHandler [GetAuraType()])(aurApp, mode, apply);
 
     // check if script events have removed the aura or if default effect prevention was requested
     if (apply && aurApp->GetRemoveMode())
@@ -23,6 +23,7 @@
 #include "PathGenerator.h"
 #include "SharedDefines.h"
 #include "SpellInfo.h"
+#include <boost/container/small_vector.hpp>
 
 class Unit;
 class Player;
@@ -264,6 +265,9 @@ struct TargetInfo
     int32  damage;
 };
 
+// Flat storage, most casts hit a handful of targets and never leave the inline buffer
+typedef boost::container::small_vector<TargetInfo, 4> TargetInfoList;
+
 static const uint32 SPELL_INTERRUPT_NONPLAYER = 32747;
 
 struct TriggeredByAuraSpellData
@@ -487,6 +491,8 @@ public:
     void WriteAmmoToPacket(WorldPacket* data);
 
     bool CheckEffectTarget(Unit const* target, uint32 eff) const;
+    bool GetEffectTargetLineOfSightChecks(uint32& losChecks) const;
+    void PrefetchEffectTargetsLineOfSight(std::list<WorldObject*> const& targets);
     bool CanAutoCast(Unit* target);
     void CheckSrc() { if (!m_targets.HasSrc()) m_targets.SetSrc(*m_caster); }
     void CheckDst() { if (!m_targets.HasDst()) m_targets.SetDst(*m_caster); }
@@ -583,7 +589,7 @@ public:
 
     // xinef: moved to public
     void LoadScripts();
-    std::list<TargetInfo>* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
+    TargetInfoList* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
 
     [[nodiscard]] uint32 GetTriggeredByAuraTickNumber() const { return m_triggeredByAuraSpell.tickNumber; }
 
@@ -678,9 +684,12 @@ public:
     // *****************************************
     // Spell target subsystem
     // *****************************************
-    std::list<TargetInfo> m_UniqueTargetInfo;
+    TargetInfoList m_UniqueTargetInfo;
     uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
 
+    // line of sight results queried in one batch for the area target selection in progress, sorted by target
+    std::vector<std::pair<Unit const*, bool>> m_prefetchedLineOfSight;
+
     struct GOTargetInfo
     {
         ObjectGuid targetGUID;
@@ -688,14 +697,16 @@ public:
         uint8  effectMask: 8;
         bool   processed: 1;
     };
-    std::list<GOTargetInfo> m_UniqueGOTargetInfo;
+    typedef boost::container::small_vector<GOTargetInfo, 1> GOTargetInfoList;
+    GOTargetInfoList m_UniqueGOTargetInfo;
 
     struct ItemTargetInfo
     {
         Item*  item;
         uint8 effectMask;
     };
-    std::list<ItemTargetInfo> m_UniqueItemInfo;
+    typedef boost::container::small_vector<ItemTargetInfo, 1> ItemTargetInfoList;
+    ItemTargetInfoList m_UniqueItemInfo;
 
     SpellDestination m_destTargets[MAX_SPELL_EFFECTS];
 
@@ -742,6 +742,19 @@ SpellProcEventEntry const* SpellMgr::GetSpellProcEvent(uint32 spellId) const
     return nullptr;
 }
 
+uint32 SpellMgr::GetAuraProcEventFlags(SpellInfo const* spellInfo) const
+{
+    // Same resolution as Unit::IsTriggeredAtSpellProcEvent
+    if (GetSpellProcEntry(spellInfo->Id))
+        return 0;
+
+    SpellProcEventEntry const* spellProcEvent = GetSpellProcEvent(spellInfo->Id);
+    if (spellProcEvent && spellProcEvent->procFlags)
+        return spellProcEvent->procFlags;
+
+    return spellInfo->ProcFlags;
+}
+
 bool SpellMgr::IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, SpellProcEventEntry const* spellProcEvent, uint32 EventProcFlag, ProcEventInfo const& eventInfo, bool active) const
 {
     // No extra req need
@@ -1730,6 +1743,7 @@ void SpellMgr::LoadSpellProcEvents()
 {
     StopWatch sw;
     mSpellProcEventMap.clear();                             // need for reload case
+    ++_procDataGeneration;
 
     auto result{ sDBCacheMgr->GetResult(DBCacheTable::SpellProcEvent) };
     if (!result)
@@ -1822,6 +1836,7 @@ void SpellMgr::LoadSpellProcs()
 {
     StopWatch sw;
     mSpellProcMap.clear();                             // need for reload case
+    ++_procDataGeneration;
 
     auto result{ sDBCacheMgr->GetResult(DBCacheTable::SpellProc) };
     if (!result)
@@ -673,6 +673,12 @@ public:
     [[nodiscard]] SpellProcEventEntry const* GetSpellProcEvent(uint32 spellId) const;
     bool IsSpellProcEventCanTriggeredBy(SpellInfo const* spellProto, SpellProcEventEntry const* spellProcEvent, uint32 EventProcFlag, ProcEventInfo const& eventInfo, bool active) const;
 
+    // Proc flags an aura can be triggered by through spell_proc_event, 0 if it never procs there (handled by spell_proc or no flags at all)
+    [[nodiscard]] uint32 GetAuraProcEventFlags(SpellInfo const* spellInfo) const;
+
+    // Bumped on every proc table (re)load, lets cached proc flag masks detect stale data
+    [[nodiscard]] uint32 GetProcDataGeneration() const { return _procDataGeneration; }
+
     // Spell proc table
     [[nodiscard]] SpellProcEntry const* GetSpellProcEntry(uint32 spellId) const;
     bool CanSpellTriggerProcOnEvent(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo) const;
@@ -798,6 +804,7 @@ private:
     PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
     SpellInfoMap               mSpellInfoMap;
     TalentAdditionalSet        mTalentSpellAdditionalSet;
+    uint32                     _procDataGeneration{ 0 };
 };
 
 #define sSpellMgr SpellMgr::instance()
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "SpellProfiler.h"
+
+SpellProfiler* SpellProfiler::instance()
+{
+    static SpellProfiler instance;
+    return &instance;
+}
+
+void SpellProfiler::Reset()
+{
+    for (Warhead::TimingCounter& counter : _effects)
+        counter.Reset();
+
+    for (Warhead::TimingCounter& counter : _auraEffects)
+        counter.Reset();
+}
+
+void SpellProfiler::AddEffectTime(uint32 effect, Nanoseconds elapsed)
+{
+    if (effect < _effects.size())
+        _effects[effect].Add(elapsed);
+}
+
+void SpellProfiler::AddAuraEffectTime(uint32 auraType, Nanoseconds elapsed)
+{
+    if (auraType < _auraEffects.size())
+        _auraEffects[auraType].Add(elapsed);
+}
+
+SpellProfilerEntry SpellProfiler::GetEffectStats(uint32 effect) const
+{
+    return effect < _effects.size() ? _effects[effect].Get() : SpellProfilerEntry();
+}
+
+SpellProfilerEntry SpellProfiler::GetAuraEffectStats(uint32 auraType) const
+{
+    return auraType < _auraEffects.size() ? _auraEffects[auraType].Get() : SpellProfilerEntry();
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _SPELL_PROFILER_H_
+#define _SPELL_PROFILER_H_
+
+#include "Define.h"
+#include "SharedDefines.h"
+#include "SpellAuraDefines.h"
+#include "TimingCounter.h"
+#include <array>
+#include <atomic>
+
+using SpellProfilerEntry = Warhead::TimingStats;
+
+// Timings of spell effect and aura effect handlers, collected from all map threads while enabled
+class WH_GAME_API SpellProfiler
+{
+public:
+    static SpellProfiler* instance();
+
+    [[nodiscard]] bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+    void SetEnabled(bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+    void Reset();
+
+    void AddEffectTime(uint32 effect, Nanoseconds elapsed);
+    void AddAuraEffectTime(uint32 auraType, Nanoseconds elapsed);
+
+    [[nodiscard]] SpellProfilerEntry GetEffectStats(uint32 effect) const;
+    [[nodiscard]] SpellProfilerEntry GetAuraEffectStats(uint32 auraType) const;
+
+private:
+    SpellProfiler() = default;
+    ~SpellProfiler() = default;
+
+    SpellProfiler(SpellProfiler const&) = delete;
+    SpellProfiler& operator=(SpellProfiler const&) = delete;
+
+    std::atomic<bool> _enabled{ false };
+    std::array<Warhead::TimingCounter, TOTAL_SPELL_EFFECTS> _effects;
+    std::array<Warhead::TimingCounter, TOTAL_AURAS> _auraEffects;
+};
+
+#define sSpellProfiler SpellProfiler::instance()
+
+#endif
@@ -261,7 +261,7 @@ void WardenWin::RequestChecks()
     {
         for (uint8 checkType = 0; checkType < MAX_WARDEN_CHECK_TYPES; ++checkType)
         {
-            for (uint32 y = 0; y < CONF_GET_UINT(GetMaxWardenChecksForType(checkType)); ++y)
+            for (uint32 y = 0; y < sGameConfig->GetOption<uint32>(GetMaxWardenChecksForType(checkType)); ++y)
             {
                 // If todo list is done break loop (will be filled on next Update() run)
                 if (_ChecksTodo[checkType].empty())
@@ -302,7 +302,7 @@ void WardenWin::RequestChecks()
         // Always include lua checks
         if (!hasLuaChecks)
         {
-            for (uint32 i = 0; i < CONF_GET_UINT(GetMaxWardenChecksForType(WARDEN_CHECK_LUA_TYPE)); ++i)
+            for (uint32 i = 0; i < sGameConfig->GetOption<uint32>(GetMaxWardenChecksForType(WARDEN_CHECK_LUA_TYPE)); ++i)
             {
                 // If todo list is done break loop (will be filled on next Update() run)
                 if (_ChecksTodo[WARDEN_CHECK_LUA_TYPE].empty())
@@ -362,10 +362,65 @@ int32 World::GetQueuePos(WorldSession* sess)
 void World::AddQueuedPlayer(WorldSession* sess)
 {
     sess->SetInQueue(true);
-    m_QueuedPlayer.push_back(sess);
+
+    // Players that were online before the restart skip everyone that was not
+    Queue::iterator iter = m_QueuedPlayer.end();
+    if (HasLoginPriority(sess->GetAccountId()))
+        iter = std::find_if(m_QueuedPlayer.begin(), m_QueuedPlayer.end(), [this](WorldSession* queued) { return !HasLoginPriority(queued->GetAccountId()); });
+
+    iter = m_QueuedPlayer.insert(iter, sess);
+    uint32 position = GetQueuePos(sess);
 
     // The 1st SMSG_AUTH_RESPONSE needs to contain other info too.
-    sess->SendAuthResponse(AUTH_WAIT_QUEUE, false, GetQueuePos(sess));
+    sess->SendAuthResponse(AUTH_WAIT_QUEUE, false, position);
+
+    // Everyone behind moved back by one
+    for (++iter; iter != m_QueuedPlayer.end(); ++iter)
+        (*iter)->SendAuthWaitQueue(++position);
+}
+
+bool World::CanStartLoginLoading(uint32 accountId) const
+{
+    uint32 loading = m_loginLoadingCount;
+
+    // Always let one through, no one would ever log in otherwise
+    if (!loading)
+        return true;
+
+    uint32 maxLoading = CONF_GET_UINT("PlayerLogin.MaxConcurrentLoads");
+    if (maxLoading && loading >= maxLoading)
+        return false;
+
+    if (HasLoginPriority(accountId))
+        return true;
+
+    uint32 maxQueueSize = CONF_GET_UINT("PlayerLogin.MaxDatabaseQueue");
+    return !maxQueueSize || CharacterDatabase.GetQueueSize() < maxQueueSize;
+}
+
+void World::UpdateLoginPriority()
+{
+    // Accounts that did not come back in time lose their priority
+    if (m_priorityLoginAccounts.empty() || GameTime::GetUptime() < Seconds(CONF_GET_UINT("PlayerLogin.RestartPriorityTime")))
+        return;
+
+    LOG_INFO("server.worldserver", "Login priority expired for {} accounts that were online before the restart", m_priorityLoginAccounts.size());
+    m_priorityLoginAccounts.clear();
+}
+
+void World::UpdateLoginMetrics()
+{
+    if (m_timesToInWorld.empty())
+        return;
+
+    auto p99 = m_timesToInWorld.begin() + (m_timesToInWorld.size() - 1) * 99 / 100;
+    std::nth_element(m_timesToInWorld.begin(), p99, m_timesToInWorld.end());
+
+    METRIC_VALUE("player_time_to_in_world_p99", uint64(p99->count()));
+    METRIC_VALUE("player_logins", uint64(m_timesToInWorld.size()));
+    METRIC_VALUE("player_login_loading", m_loginLoadingCount.load());
+
+    m_timesToInWorld.clear();
 }
 
 bool World::RemoveQueuedPlayer(WorldSession* sess)
@@ -1103,14 +1158,21 @@ void World::SetInitialWorldSettings()
     // our speed up
     m_timers[WUPDATE_5_SECS].SetInterval(5 * IN_MILLISECONDS);
 
-    m_timers[WUPDATE_WHO_LIST].SetInterval(5 * IN_MILLISECONDS); // update who list cache every 5 seconds
+    m_timers[WUPDATE_WHO_LIST].SetInterval(1 * IN_MILLISECONDS); // apply queued who list changes every second
 
-    mail_expire_check_timer = GameTime::GetGameTime() + 6h;
+    mail_expire_check_timer = GameTime::GetGameTime() + Seconds(CONF_GET_UINT("Mail.ExpiredSweep.Interval"));
 
     ///- Initialize MapMgr
     LOG_INFO("server.loading", "Starting Map System");
     sMapMgr->Initialize();
 
+    int32 sessionThreads = CONF_GET_INT("SessionUpdate.Threads");
+    if (sessionThreads > 0)
+    {
+        _sessionUpdater.Activate(sessionThreads);
+        LOG_INFO("server.loading", ">> Added {} threads for parallel session update", sessionThreads);
+    }
+
     LOG_INFO("server.loading", "Starting Game Event system...");
     uint32 nextGameEvent = sGameEventMgr->StartSystem();
     m_timers[WUPDATE_EVENTS].SetInterval(nextGameEvent);    //depend on next event
@@ -1301,6 +1363,9 @@ void World::Update(uint32 diff)
         // moved here from HandleCharEnumOpcode
         CharacterDatabasePreparedStatement stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_BANS);
         CharacterDatabase.Execute(stmt);
+
+        UpdateLoginMetrics();
+        UpdateLoginPriority();
     }
 
     ///- Update Who List Cache
@@ -1366,14 +1431,15 @@ void World::Update(uint32 diff)
     {
         std::lock_guard<std::mutex> guard(AsyncAuctionListingMgr::GetLock());
 
-        // pussywizard: handle auctions when the timer has passed
         if (m_timers[WUPDATE_AUCTIONS].Passed())
         {
-            METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update expired auctions"));
-
             m_timers[WUPDATE_AUCTIONS].Reset();
+            sScriptMgr->OnBeforeAuctionHouseMgrUpdate();
+        }
 
-            // pussywizard: handle expired auctions, auctions expired when realm was offline are also handled here (not during loading when many required things aren't loaded yet)
+        // pussywizard: handle expired auctions, auctions expired when realm was offline are also handled here (not during loading when many required things aren't loaded yet)
+        {
+            METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update expired auctions"));
             sAuctionMgr->Update();
         }
 
@@ -1382,7 +1448,7 @@ void World::Update(uint32 diff)
         if (currentGameTime > mail_expire_check_timer)
         {
             sObjectMgr->ReturnOrDeleteOldMails(true);
-            mail_expire_check_timer = currentGameTime + 6h;
+            mail_expire_check_timer = currentGameTime + Seconds(CONF_GET_UINT("Mail.ExpiredSweep.Interval"));
         }
 
         /// <li> Handle session updates when the timer has passed
@@ -1526,6 +1592,14 @@ void World::Update(uint32 diff)
         // Stats logger update
         sMetric->Update();
         METRIC_VALUE("update_time_diff", diff);
+
+        if (sLog->IsAsync())
+        {
+            Warhead::Log::AsyncStats logStats = sLog->GetAsyncStats();
+            METRIC_VALUE("log_messages_written", logStats.Written);
+            METRIC_VALUE("log_messages_dropped", logStats.Dropped);
+            METRIC_VALUE("log_queue_size", uint64(logStats.Queued));
+        }
     }
 }
 
@@ -1803,6 +1877,25 @@ void World::UpdateSessions(uint32 diff)
         }
     }
 
+    ///- Process the session-local packets in parallel, the rest waits for the serial update below
+    ///- Only sessions that queued such a packet are handed out, the pool is left alone when there are none
+    if (_sessionUpdater.IsActive())
+    {
+        METRIC_DETAILED_NO_THRESHOLD_TIMER("world_update_time",
+            METRIC_TAG("type", "Parallel sessions"),
+            METRIC_TAG("parent_type", "Update sessions"));
+
+        _parallelSessions.clear();
+
+        for (auto const& [accountId, session] : m_sessions)
+            if (session->TakeSessionLocalPackets() && !session->IsSocketClosed())
+                _parallelSessions.push_back(session);
+
+        METRIC_VALUE("parallel_sessions", uint64(_parallelSessions.size()));
+
+        _sessionUpdater.ProcessSessionPackets(_parallelSessions);
+    }
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = m_sessions.begin(), next; itr != m_sessions.end(); itr = next)
     {
@@ -29,10 +29,13 @@
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
 #include "Timer.h"
+#include "WorldSessionUpdater.h"
 #include <atomic>
 #include <list>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 class Object;
 class WorldPacket;
@@ -226,6 +229,19 @@ public:
     int32 GetQueuePos(WorldSession*);
     bool HasRecentlyDisconnected(WorldSession*);
 
+    /// Login admission, holds back character loading while the characters database is overloaded (e.g. after a restart)
+    [[nodiscard]] bool CanStartLoginLoading(uint32 accountId) const;
+    void StartLoginLoading() { ++m_loginLoadingCount; }
+    void FinishLoginLoading() { --m_loginLoadingCount; }
+    [[nodiscard]] uint32 GetLoginLoadingCount() const { return m_loginLoadingCount; }
+    void AddTimeToInWorld(Milliseconds time) { m_timesToInWorld.emplace_back(time); }
+
+    /// Accounts that were online before the restart, they get priority in the login queue and admission
+    void SetPriorityLoginAccounts(std::unordered_set<uint32>&& accounts) { m_priorityLoginAccounts = std::move(accounts); }
+    [[nodiscard]] bool HasLoginPriority(uint32 accountId) const { return m_priorityLoginAccounts.contains(accountId); }
+    void RemoveLoginPriority(uint32 accountId) { m_priorityLoginAccounts.erase(accountId); }
+    void UpdateLoginPriority();
+
     /// \todo Actions on m_allowMovement still to be implemented
     /// Is movement allowed?
     [[nodiscard]] bool getAllowMovement() const { return m_allowMovement; }
@@ -357,6 +373,8 @@ private:
 
     SessionMap m_sessions;
     SessionMap m_offlineSessions;
+    WorldSessionUpdater _sessionUpdater;
+    std::vector<WorldSession*> _parallelSessions;
     typedef std::unordered_map<uint32, time_t> DisconnectMap;
     DisconnectMap m_disconnects;
     uint32 m_maxActiveSessionCount;
@@ -394,6 +412,12 @@ private:
     //Player Queue
     Queue m_QueuedPlayer;
 
+    // Login admission
+    std::atomic<uint32> m_loginLoadingCount{};
+    std::unordered_set<uint32> m_priorityLoginAccounts;
+    std::vector<Milliseconds> m_timesToInWorld;
+    void UpdateLoginMetrics();
+
     // sessions that are added async
     void AddSession_(WorldSession* s);
     LockedQueue<WorldSession*> addSessQueue;
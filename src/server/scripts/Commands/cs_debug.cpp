@@ -30,6 +30,7 @@
 #include "CellImpl.h"
 #include "Channel.h"
 #include "Chat.h"
+#include "GameConfig.h"
 #include "GossipDef.h"
 #include "GridNotifiersImpl.h"
 #include "InstanceScript.h"
@@ -39,10 +40,12 @@
 #include "M2Stores.h"
 #include "MapMgr.h"
 #include "ObjectMgr.h"
+#include "OpcodeProfiler.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
 #include "ScriptObject.h"
 #include "SpellMgr.h"
+#include "SpellProfiler.h"
 #include "Transport.h"
 #include "Warden.h"
 #include <fstream>
@@ -110,6 +113,10 @@ public:
             { "moveflags",      HandleDebugMoveflagsCommand,           SEC_ADMINISTRATOR, Console::No },
             { "unitstate",      HandleDebugUnitStateCommand,           SEC_ADMINISTRATOR, Console::No },
             { "objectcount",    HandleDebugObjectCountCommand,         SEC_ADMINISTRATOR, Console::Yes},
+            { "spellbench",     HandleDebugSpellBenchCommand,          SEC_ADMINISTRATOR, Console::No },
+            { "spellprofile",   HandleDebugSpellProfileCommand,        SEC_ADMINISTRATOR, Console::Yes},
+            { "configbench",    HandleDebugConfigBenchCommand,         SEC_ADMINISTRATOR, Console::Yes},
+            { "opcodeprofile",  HandleDebugOpcodeProfileCommand,       SEC_ADMINISTRATOR, Console::Yes},
             { "dummy",          HandleDebugDummyCommand,               SEC_ADMINISTRATOR, Console::No }
         };
         static ChatCommandTable commandTable =
@@ -1351,6 +1358,192 @@ public:
             handler->PSendSysMessage("Entry: {} Count: {}", p.first, p.second);
     }
 
+    static void SendSpellProfile(ChatHandler* handler, uint64 casts)
+    {
+        struct HandlerTiming
+        {
+            char const* Kind;
+            uint32 Id;
+            SpellProfilerEntry Stats;
+        };
+
+        std::vector<HandlerTiming> timings;
+
+        for (uint32 effect = 0; effect < TOTAL_SPELL_EFFECTS; ++effect)
+        {
+            SpellProfilerEntry stats = sSpellProfiler->GetEffectStats(effect);
+            if (stats.Calls)
+                timings.push_back({ "effect", effect, stats });
+        }
+
+        for (uint32 auraType = 0; auraType < TOTAL_AURAS; ++auraType)
+        {
+            SpellProfilerEntry stats = sSpellProfiler->GetAuraEffectStats(auraType);
+            if (stats.Calls)
+                timings.push_back({ "aura", auraType, stats });
+        }
+
+        if (timings.empty())
+        {
+            handler->SendSysMessage("No spell effect handler was timed.");
+            return;
+        }
+
+        std::sort(timings.begin(), timings.end(), [](HandlerTiming const& left, HandlerTiming const& right)
+        {
+            return left.Stats.Total > right.Stats.Total;
+        });
+
+        for (HandlerTiming const& timing : timings)
+        {
+            handler->PSendSysMessage("  {} {:3}: {} calls, {} ns total, {} ns avg, {} ns max{}", timing.Kind, timing.Id, timing.Stats.Calls,
+                timing.Stats.Total.count(), timing.Stats.Total.count() / timing.Stats.Calls, timing.Stats.Max.count(),
+                casts ? Warhead::StringFormat(", {} ns per cast", timing.Stats.Total.count() / casts) : "");
+        }
+    }
+
+    // Casts the given spell sequence <count> times from the player on the selected unit and reports cast and handler timings.
+    // Casts are fully triggered, so cast times, costs and cooldowns are skipped; delayed (missile) hits are not included.
+    static bool HandleDebugSpellBenchCommand(ChatHandler* handler, uint32 count, std::vector<SpellInfo const*> spells)
+    {
+        Player* player = handler->GetSession()->GetPlayer();
+        Unit* target = handler->getSelectedUnit();
+        if (!target)
+            target = player;
+
+        count = std::clamp<uint32>(count, 1, 10000);
+
+        bool wasEnabled = sSpellProfiler->IsEnabled();
+        sSpellProfiler->Reset();
+        sSpellProfiler->SetEnabled(true);
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint32 i = 0; i < count; ++i)
+            for (SpellInfo const* spellInfo : spells)
+                player->CastSpell(target, spellInfo, TRIGGERED_FULL_MASK);
+
+        Nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+
+        sSpellProfiler->SetEnabled(wasEnabled);
+
+        uint64 casts = uint64(count) * spells.size();
+        handler->PSendSysMessage("Cast {} spells {} times on {}: {} casts in {} us, {} ns per cast.", spells.size(), count, target->GetName(),
+            casts, std::chrono::duration_cast<Microseconds>(elapsed).count(), elapsed.count() / casts);
+
+        SendSpellProfile(handler, casts);
+        return true;
+    }
+
+    // Profiles spell effect handlers of live traffic on all maps: on resets and starts, off stops, no argument shows the results
+    static bool HandleDebugSpellProfileCommand(ChatHandler* handler, Optional<bool> enable)
+    {
+        if (enable)
+        {
+            if (*enable)
+                sSpellProfiler->Reset();
+
+            sSpellProfiler->SetEnabled(*enable);
+            handler->PSendSysMessage("Spell effect profiling {}.", *enable ? "started" : "stopped");
+            return true;
+        }
+
+        handler->PSendSysMessage("Spell effect profiling is {}.", sSpellProfiler->IsEnabled() ? "running" : "stopped");
+        SendSpellProfile(handler, 0);
+        return true;
+    }
+
+    // Reads a few options used in combat <count> times through the name lookup and through the typed handles
+    // Runs on the world thread, so the count is capped to keep the stall short
+    static bool HandleDebugConfigBenchCommand(ChatHandler* handler, Optional<uint32> count)
+    {
+        uint32 reads = std::clamp<uint32>(count.value_or(100000), 1, 1000000);
+
+        float sum = 0.0f;
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint32 i = 0; i < reads; ++i)
+        {
+            sum += sGameConfig->GetOption<float>("Rate.MissChanceMultiplier.TargetCreature");
+            sum += sGameConfig->GetOption<float>("DurabilityLossChance.Damage");
+            sum += sGameConfig->GetOption<float>("Rate.Rage.Income");
+        }
+
+        Nanoseconds byName = std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+
+        for (uint32 i = 0; i < reads; ++i)
+        {
+            sum += CONF_GET_FLOAT("Rate.MissChanceMultiplier.TargetCreature");
+            sum += CONF_GET_FLOAT("DurabilityLossChance.Damage");
+            sum += CONF_GET_FLOAT("Rate.Rage.Income");
+        }
+
+        Nanoseconds byHandle = std::chrono::steady_clock::now() - start;
+
+        uint64 total = uint64(reads) * 3;
+        handler->PSendSysMessage("{} option reads (checksum {}):", total, sum);
+        handler->PSendSysMessage("  by name:   {} us, {:.2f} ns per read", std::chrono::duration_cast<Microseconds>(byName).count(), double(byName.count()) / total);
+        handler->PSendSysMessage("  by handle: {} us, {:.2f} ns per read", std::chrono::duration_cast<Microseconds>(byHandle).count(), double(byHandle.count()) / total);
+        return true;
+    }
+
+    // Profiles client opcode handlers of live traffic: on resets and starts, off stops, no argument shows the results
+    // The processing column shows where the handler runs, to check which handlers are worth (and safe) to move to the parallel phase
+    static bool HandleDebugOpcodeProfileCommand(ChatHandler* handler, Optional<bool> enable)
+    {
+        if (enable)
+        {
+            if (*enable)
+                sOpcodeProfiler->Reset();
+
+            sOpcodeProfiler->SetEnabled(*enable);
+            handler->PSendSysMessage("Opcode handler profiling {}.", *enable ? "started" : "stopped");
+            return true;
+        }
+
+        handler->PSendSysMessage("Opcode handler profiling is {}.", sOpcodeProfiler->IsEnabled() ? "running" : "stopped");
+
+        std::vector<std::pair<uint16, OpcodeProfilerEntry>> timings;
+
+        for (uint16 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+        {
+            OpcodeProfilerEntry stats = sOpcodeProfiler->GetHandlerStats(opcode);
+            if (stats.Calls)
+                timings.emplace_back(opcode, stats);
+        }
+
+        if (timings.empty())
+        {
+            handler->SendSysMessage("No opcode handler was timed.");
+            return true;
+        }
+
+        std::sort(timings.begin(), timings.end(), [](auto const& left, auto const& right)
+        {
+            return left.second.Total > right.second.Total;
+        });
+
+        for (auto const& [opcode, stats] : timings)
+        {
+            ClientOpcodeHandler const* opHandle = OpcodeProfiler::GetHandler(opcode);
+
+            char const* processing = "inplace";
+            switch (opHandle->ProcessingPlace)
+            {
+                case PROCESS_THREADUNSAFE: processing = "world"; break;
+                case PROCESS_THREADSAFE: processing = "map"; break;
+                case PROCESS_THREADSAFE_SESSION: processing = "parallel"; break;
+                default: break;
+            }
+
+            handler->PSendSysMessage("  {} ({}): {} calls, {} ns total, {} ns avg, {} ns max", opHandle->Name, processing, stats.Calls,
+                stats.Total.count(), stats.Total.count() / stats.Calls, stats.Max.count());
+        }
+
+        return true;
+    }
+
     static bool HandleDebugDummyCommand(ChatHandler* handler)
     {
         handler->SendSysMessage("This command does nothing right now. Edit your local core (cs_debug.cpp) to make it do whatever you need for testing.");
@@ -497,8 +497,8 @@ class spell_pet_gen_valkyr_guardian_smite : public SpellScript
     {
         if (GetHitUnit() != GetCaster())
         {
-            std::list<TargetInfo>* targetsInfo = GetSpell()->GetUniqueTargetInfo();
-            for (std::list<TargetInfo>::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
+            TargetInfoList* targetsInfo = GetSpell()->GetUniqueTargetInfo();
+            for (TargetInfoList::iterator ihit = targetsInfo->begin(); ihit != targetsInfo->end(); ++ihit)
                 if (ihit->targetGUID == GetCaster()->GetGUID())
                     ihit->damage = -int32(GetHitDamage() * 0.25f);
         }
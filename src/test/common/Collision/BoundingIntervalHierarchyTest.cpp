@@ -0,0 +1,134 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BoundingIntervalHierarchy.h"
+#include "gtest/gtest.h"
+#include <random>
+
+namespace
+{
+    std::vector<G3D::AABox> boxes;
+
+    struct BoxBounds
+    {
+        void operator()(G3D::AABox const& box, G3D::AABox& out) const { out = box; }
+    };
+
+    bool IntersectBox(G3D::Ray const& ray, uint32 entry, float& distance)
+    {
+        float tmin = 0.f, tmax = distance;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            float org = ray.origin()[axis];
+            float dir = ray.direction()[axis];
+            float lo = boxes[entry].low()[axis];
+            float hi = boxes[entry].high()[axis];
+            if (dir == 0.f)
+            {
+                if (org < lo || org > hi)
+                    return false;
+                continue;
+            }
+
+            float t1 = (lo - org) / dir;
+            float t2 = (hi - org) / dir;
+            if (t1 > t2)
+                std::swap(t1, t2);
+            tmin = std::max(tmin, t1);
+            tmax = std::min(tmax, t2);
+            if (tmin > tmax)
+                return false;
+        }
+
+        distance = tmin;
+        return true;
+    }
+
+    struct SingleCallback
+    {
+        bool hit = false;
+        bool operator()(G3D::Ray const& ray, uint32 entry, float& distance, bool /*stopAtFirstHit*/)
+        {
+            bool result = IntersectBox(ray, entry, distance);
+            hit |= result;
+            return result;
+        }
+    };
+
+    struct BatchCallback
+    {
+        std::vector<bool>& hits;
+        bool operator()(uint32 rayIndex, G3D::Ray const& ray, uint32 entry, float& distance, bool /*stopAtFirstHit*/)
+        {
+            bool result = IntersectBox(ray, entry, distance);
+            if (result)
+                hits[rayIndex] = true;
+            return result;
+        }
+    };
+}
+
+// AoE shaped queries: rays from a shared caster position to targets around it, plus vertical height rays
+TEST(BoundingIntervalHierarchyTest, intersectRays_matches_intersectRay)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> world(0.f, 500.f), size(1.f, 20.f), radius(-30.f, 30.f);
+
+    boxes.clear();
+    for (int i = 0; i < 2000; ++i)
+    {
+        G3D::Vector3 lo(world(rng), world(rng), world(rng) / 5.f);
+        boxes.emplace_back(lo, lo + G3D::Vector3(size(rng), size(rng), size(rng)));
+    }
+
+    BIH tree;
+    BoxBounds bounds;
+    tree.build(boxes, bounds);
+
+    std::vector<G3D::Ray> rays;
+    std::vector<float> maxDists;
+    G3D::Vector3 center;
+    for (int i = 0; i < 2500; ++i)
+    {
+        if (i % 25 == 0)
+            center = G3D::Vector3(world(rng), world(rng), world(rng) / 5.f);
+
+        G3D::Vector3 target = (i % 5 == 0) ? center + G3D::Vector3(radius(rng), radius(rng), -50.f) : center + G3D::Vector3(radius(rng), radius(rng), radius(rng) / 10.f);
+        float dist = (target - center).magnitude();
+        rays.push_back(G3D::Ray::fromOriginAndDirection(center, (target - center) / dist));
+        maxDists.push_back(dist);
+    }
+
+    for (bool stopAtFirstHit : { true, false })
+    {
+        std::vector<bool> batchHits(rays.size(), false);
+        std::vector<float> batchDists = maxDists;
+        BatchCallback batchCallback{ batchHits };
+        tree.intersectRays(rays.data(), batchDists.data(), rays.size(), batchCallback, stopAtFirstHit);
+
+        for (std::size_t i = 0; i < rays.size(); ++i)
+        {
+            float dist = maxDists[i];
+            SingleCallback callback;
+            tree.intersectRay(rays[i], callback, dist, stopAtFirstHit);
+
+            EXPECT_EQ(callback.hit, batchHits[i]) << "ray " << i;
+            if (!stopAtFirstHit)
+                EXPECT_FLOAT_EQ(dist, batchDists[i]) << "ray " << i;
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Metric.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <string>
+
+using testing::HasSubstr;
+using testing::Not;
+
+namespace
+{
+    SystemTimePoint const BatchTime(std::chrono::seconds(1000));
+
+    class MetricTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            // Drop whatever earlier tests left in the thread stores
+            sMetric->EncodeBatch(BatchTime);
+        }
+
+        static std::string Encode()
+        {
+            return std::string(sMetric->EncodeBatch(BatchTime));
+        }
+    };
+}
+
+TEST_F(MetricTest, GaugeFields)
+{
+    sMetric->LogValue("test_gauge", 3, {});
+    sMetric->LogValue("test_gauge", 7, {});
+    sMetric->LogValue("test_gauge", 5, {});
+
+    EXPECT_THAT(Encode(), HasSubstr("test_gauge value=5i,count=3i,sum=15i,min=3i,max=7i 1000000000000\n"));
+}
+
+TEST_F(MetricTest, TimerFields)
+{
+    sMetric->LogValue("test_timer", Milliseconds(2), {});
+    sMetric->LogValue("test_timer", Milliseconds(4), {});
+
+    EXPECT_THAT(Encode(), HasSubstr("test_timer value=3i,count=2i,sum=6.000,min=2.000,max=4.000 1000000000000\n"));
+}
+
+TEST_F(MetricTest, TagsAreEscaped)
+{
+    sMetric->LogValue("test tagged", 1, { METRIC_TAG("key", "a b,c") });
+
+    EXPECT_THAT(Encode(), HasSubstr("test\\ tagged,key=a\\ b\\,c value=1i,count=1i,sum=1i,min=1i,max=1i"));
+}
+
+TEST_F(MetricTest, IdleSeriesIsNotSent)
+{
+    sMetric->LogValue("test_idle", 1, {});
+    EXPECT_THAT(Encode(), HasSubstr("test_idle "));
+    EXPECT_THAT(Encode(), Not(HasSubstr("test_idle ")));
+}
+
+TEST_F(MetricTest, ExpiredSeriesIdIsReused)
+{
+    sMetric->LogValue("test_expire_a", 1, {});
+    Encode();
+
+    MetricSeries const* expired = sMetric->GetSeries("test_expire_a", {}, METRIC_SERIES_GAUGE);
+    ASSERT_NE(expired, nullptr);
+    uint32 expiredId = expired->Id;
+
+    // Expiry after Metric.SeriesExpireIntervals (default 60) idle batches, the id cools down for two more
+    for (uint32 i = 0; i < 61; ++i)
+        Encode();
+
+    MetricSeries const* cooling = sMetric->GetSeries("test_expire_b", {}, METRIC_SERIES_GAUGE);
+    ASSERT_NE(cooling, nullptr);
+    EXPECT_NE(cooling->Id, expiredId);
+
+    Encode();
+
+    MetricSeries const* reused = sMetric->GetSeries("test_expire_c", {}, METRIC_SERIES_GAUGE);
+    ASSERT_NE(reused, nullptr);
+    EXPECT_EQ(reused->Id, expiredId);
+
+    // the expired series gets a new id, its samples don't end up in the series that took over the old one
+    sMetric->LogValue("test_expire_c", 7, {});
+    sMetric->LogValue("test_expire_a", 2, {});
+
+    std::string batch = Encode();
+    EXPECT_THAT(batch, HasSubstr("test_expire_a value=2i,count=1i,sum=2i,min=2i,max=2i"));
+    EXPECT_THAT(batch, HasSubstr("test_expire_c value=7i,count=1i,sum=7i,min=7i,max=7i"));
+}
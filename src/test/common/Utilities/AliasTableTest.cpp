@@ -0,0 +1,61 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AliasTable.h"
+#include "gtest/gtest.h"
+#include <random>
+
+namespace
+{
+    constexpr uint32 Samples = 200000;
+}
+
+TEST(AliasTableTest, Empty)
+{
+    Warhead::AliasTable table;
+    EXPECT_TRUE(table.empty());
+
+    table.Build(std::vector<double>{ 0.0, 0.0 });
+    EXPECT_TRUE(table.empty());
+}
+
+TEST(AliasTableTest, ZeroWeightIsNeverPicked)
+{
+    Warhead::AliasTable table(std::vector<double>{ 0.0, 1.0, 0.0, 3.0 });
+
+    for (double u = 0.0; u < 1.0; u += 0.001)
+    {
+        std::size_t outcome = table.Sample(u);
+        EXPECT_TRUE(outcome == 1 || outcome == 3);
+    }
+}
+
+TEST(AliasTableTest, Frequencies)
+{
+    std::vector<double> weights{ 1.0, 2.0, 3.0, 4.0 };
+    Warhead::AliasTable table(weights);
+
+    std::mt19937 engine(42);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    std::vector<uint32> hits(weights.size());
+    for (uint32 i = 0; i < Samples; ++i)
+        ++hits[table.Sample(uniform(engine))];
+
+    for (std::size_t i = 0; i < weights.size(); ++i)
+        EXPECT_NEAR(double(hits[i]) / Samples, weights[i] / 10.0, 0.01);
+}
@@ -0,0 +1,32 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CharacterDatabase.h"
+#include "gtest/gtest.h"
+
+TEST(CharacterDatabaseTest, MailBoxStatementsArePreparedForTheQueryHolder)
+{
+    CharacterDatabasePool pool;
+    pool.DoPrepareStatements();
+
+    // WorldSession::LoadMailBox reads both through an async query holder
+    EXPECT_TRUE(pool.IsStatementPreparedFor(CHAR_SEL_MAIL, ConnectionFlags::Async));
+    EXPECT_TRUE(pool.IsStatementPreparedFor(CHAR_SEL_MAILITEMS, ConnectionFlags::Async));
+
+    // Player::DeleteFromDB queries the mailed items directly
+    EXPECT_TRUE(pool.IsStatementPreparedFor(CHAR_SEL_MAILITEMS, ConnectionFlags::Sync));
+}
@@ -0,0 +1,239 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BattlegroundQueue.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <random>
+
+namespace
+{
+    using TeamList = std::list<GroupQueueInfo*>;
+
+    struct Window
+    {
+        uint32 MinRating;
+        uint32 MaxRating;
+        Milliseconds DiscardTime;
+        Milliseconds DiscardOpponentsTime;
+    };
+
+    bool InWindow(GroupQueueInfo const* ginfo, Window const& window)
+    {
+        return !ginfo->IsInvitedToBGInstanceGUID
+            && ((ginfo->ArenaMatchmakerRating >= window.MinRating && ginfo->ArenaMatchmakerRating <= window.MaxRating) || ginfo->JoinTime < window.DiscardTime);
+    }
+
+    // Same walks as the list based BattlegroundQueue::BattlegroundQueueUpdate rated arena matching
+    TeamList::iterator ListSelectFirst(TeamList& teams, Window const& window)
+    {
+        return std::find_if(teams.begin(), teams.end(), [&](GroupQueueInfo const* ginfo) { return InWindow(ginfo, window); });
+    }
+
+    GroupQueueInfo* ListSelectSecond(TeamList& teams, TeamList::iterator first, Window const& window)
+    {
+        for (auto itr = first; itr != teams.end(); ++itr)
+            if (InWindow(*itr, window)
+                && ((*first)->ArenaTeamId != (*itr)->PreviousOpponentsTeamId || (*itr)->JoinTime < window.DiscardOpponentsTime)
+                && (*first)->ArenaTeamId != (*itr)->ArenaTeamId)
+                return *itr;
+
+        return nullptr;
+    }
+
+    struct Queue
+    {
+        std::vector<std::unique_ptr<GroupQueueInfo>> Storage;
+        TeamList Lists[PVP_TEAMS_COUNT];
+        RatedArenaQueueIndex Index[PVP_TEAMS_COUNT];
+
+        GroupQueueInfo* Join(uint32 teamId, uint8 side, uint32 rating, Milliseconds joinTime, uint32 previousOpponent)
+        {
+            GroupQueueInfo* ginfo = Storage.emplace_back(std::make_unique<GroupQueueInfo>()).get();
+            ginfo->ArenaTeamId = teamId;
+            ginfo->ArenaMatchmakerRating = rating;
+            ginfo->JoinTime = joinTime;
+            ginfo->PreviousOpponentsTeamId = previousOpponent;
+            ginfo->GroupType = side;
+            Lists[side].push_back(ginfo);
+            Index[side].Add(ginfo);
+            return ginfo;
+        }
+
+        void Leave(GroupQueueInfo* ginfo)
+        {
+            Lists[ginfo->GroupType].remove(ginfo);
+            Index[ginfo->GroupType].Remove(ginfo);
+        }
+
+        void Invite(GroupQueueInfo* ginfo)
+        {
+            ginfo->IsInvitedToBGInstanceGUID = 1;
+            Index[ginfo->GroupType].Remove(ginfo);
+        }
+    };
+}
+
+TEST(RatedArenaQueueIndexTest, SelectFirstUsesWindowAndDiscardTimer)
+{
+    Queue queue;
+    GroupQueueInfo* old = queue.Join(1, TEAM_ALLIANCE, 2400, 1000ms, 0);
+    GroupQueueInfo* mid = queue.Join(2, TEAM_ALLIANCE, 1500, 2000ms, 0);
+    GroupQueueInfo* low = queue.Join(3, TEAM_ALLIANCE, 1450, 3000ms, 0);
+
+    EXPECT_EQ(queue.Index[TEAM_ALLIANCE].SelectFirst(1400, 1600, 0ms), mid);
+    EXPECT_EQ(queue.Index[TEAM_ALLIANCE].SelectFirst(1400, 1600, 1500ms), old);
+    EXPECT_EQ(queue.Index[TEAM_ALLIANCE].SelectFirst(1000, 1200, 0ms), nullptr);
+
+    queue.Invite(mid);
+    EXPECT_EQ(queue.Index[TEAM_ALLIANCE].SelectFirst(1400, 1600, 0ms), low);
+    EXPECT_EQ(queue.Index[TEAM_ALLIANCE].GetSize(), 2u);
+}
+
+TEST(RatedArenaQueueIndexTest, SelectSecondSkipsPreviousOpponents)
+{
+    Queue queue;
+    GroupQueueInfo* first = queue.Join(1, TEAM_HORDE, 1500, 1000ms, 0);
+    GroupQueueInfo* second = queue.Join(2, TEAM_HORDE, 1510, 2000ms, 1);
+    GroupQueueInfo* third = queue.Join(3, TEAM_HORDE, 1490, 3000ms, 0);
+
+    EXPECT_EQ(queue.Index[TEAM_HORDE].SelectSecond(first, 1350, 1650, 0ms, 0ms), third);
+    EXPECT_EQ(queue.Index[TEAM_HORDE].SelectSecond(first, 1350, 1650, 0ms, 2500ms), second);
+    EXPECT_EQ(queue.Index[TEAM_HORDE].SelectSecond(first, 1500, 1650, 0ms, 0ms), nullptr);
+}
+
+TEST(RatedArenaQueueIndexTest, SimulatorMatchesListWalk)
+{
+    constexpr uint32 Teams = 4000;
+    constexpr uint32 MaxRatingDifference = 150;
+    constexpr Milliseconds RatingDiscardTimer = 600000ms;
+    constexpr Milliseconds OpponentsDiscardTimer = 120000ms;
+
+    std::mt19937 engine(4242);
+    std::normal_distribution<double> ratings(1500.0, 300.0);
+    std::uniform_int_distribution<uint32> percent(0, 99);
+
+    Queue queue;
+    Milliseconds now = 0ms;
+    uint32 nextTeamId = 1;
+
+    auto join = [&]()
+    {
+        uint32 rating = uint32(std::clamp(ratings(engine), 0.0, 3500.0));
+        uint32 previous = nextTeamId > 1 && percent(engine) < 20 ? nextTeamId - 1 : 0;
+        queue.Join(nextTeamId, uint8(percent(engine) % PVP_TEAMS_COUNT), rating, now, previous);
+        ++nextTeamId;
+    };
+
+    for (uint32 i = 0; i < Teams; ++i)
+    {
+        now += 50ms;
+        join();
+    }
+
+    using Clock = std::chrono::steady_clock;
+    Clock::duration listTime{}, indexTime{};
+    uint32 matches = 0, updates = 0;
+
+    for (uint32 step = 0; step < Teams; ++step)
+    {
+        now += 250ms;
+
+        // queue churn: new teams join, some leave before being matched
+        if (percent(engine) < 50)
+            join();
+
+        if (percent(engine) < 5 && !queue.Index[TEAM_ALLIANCE].IsEmpty())
+            queue.Leave(queue.Index[TEAM_ALLIANCE].GetOldest());
+
+        GroupQueueInfo* oldest = queue.Index[TEAM_ALLIANCE].GetOldest();
+        GroupQueueInfo* oldestHorde = queue.Index[TEAM_HORDE].GetOldest();
+        if (!oldest || (oldestHorde && oldestHorde->JoinTime < oldest->JoinTime))
+            oldest = oldestHorde;
+
+        if (!oldest)
+            break;
+
+        uint32 rating = oldest->ArenaMatchmakerRating;
+        Window window{ rating <= MaxRatingDifference ? 0 : rating - MaxRatingDifference, rating + MaxRatingDifference, now - RatingDiscardTimer, now - OpponentsDiscardTimer };
+
+        // list walk
+        Clock::time_point start = Clock::now();
+        GroupQueueInfo* listTeams[PVP_TEAMS_COUNT] = { };
+        uint8 listFound = 0, listSide = 0;
+        TeamList::iterator listFirst;
+        for (uint8 side = 0; side < PVP_TEAMS_COUNT; ++side)
+        {
+            auto itr = ListSelectFirst(queue.Lists[side], window);
+            if (itr != queue.Lists[side].end())
+            {
+                if (!listFound)
+                    listFirst = itr;
+
+                listTeams[listFound++] = *itr;
+                listSide = side;
+            }
+        }
+
+        if (listFound == 1)
+            if (GroupQueueInfo* second = ListSelectSecond(queue.Lists[listSide], listFirst, window))
+                listTeams[listFound++] = second;
+
+        listTime += Clock::now() - start;
+
+        // index
+        start = Clock::now();
+        GroupQueueInfo* indexTeams[PVP_TEAMS_COUNT] = { };
+        uint8 indexFound = 0, indexSide = 0;
+        for (uint8 side = 0; side < PVP_TEAMS_COUNT; ++side)
+        {
+            if (GroupQueueInfo* first = queue.Index[side].SelectFirst(window.MinRating, window.MaxRating, window.DiscardTime))
+            {
+                indexTeams[indexFound++] = first;
+                indexSide = side;
+            }
+        }
+
+        if (indexFound == 1)
+            if (GroupQueueInfo* second = queue.Index[indexSide].SelectSecond(indexTeams[0], window.MinRating, window.MaxRating, window.DiscardTime, window.DiscardOpponentsTime))
+                indexTeams[indexFound++] = second;
+
+        indexTime += Clock::now() - start;
+        ++updates;
+
+        ASSERT_EQ(indexFound, listFound) << "step " << step;
+        ASSERT_EQ(indexTeams[0], listTeams[0]) << "step " << step;
+        ASSERT_EQ(indexTeams[1], listTeams[1]) << "step " << step;
+
+        if (indexFound == 2)
+        {
+            queue.Invite(indexTeams[0]);
+            queue.Invite(indexTeams[1]);
+            ++matches;
+        }
+    }
+
+    EXPECT_GT(matches, 0u);
+
+    auto averageNs = [updates](Clock::duration total) { return std::chrono::duration_cast<std::chrono::nanoseconds>(total).count() / std::max<uint32>(updates, 1); };
+    RecordProperty("matches", int(matches));
+    RecordProperty("list_walk_avg_ns", int(averageNs(listTime)));
+    RecordProperty("index_avg_ns", int(averageNs(indexTime)));
+}
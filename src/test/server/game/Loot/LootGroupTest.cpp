@@ -0,0 +1,131 @@
+/*
+ * This file is part of the WarheadCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LootMgr.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    constexpr uint32 Samples = 200000;
+    constexpr uint8 GroupId = 1;
+
+    // Grouped references need no item template, so the group compiles without a world database
+    class LootGroupTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            _template = std::make_unique<LootTemplate>();
+        }
+
+        void AddEntries(std::vector<float> const& chances, uint32 equalChanced)
+        {
+            for (float chance : chances)
+                AddEntry(chance);
+
+            for (uint32 i = 0; i < equalChanced; ++i)
+                AddEntry(0.0f);
+
+            _template->CompileGroups();
+        }
+
+        // Share of the rolls that picked each entry, in the order they were added, then the empty drop
+        std::vector<double> RollShares(bool compiled)
+        {
+            Loot loot;
+
+            // an item of the same group in the loot makes the group use the sequential roll
+            if (!compiled)
+            {
+                LootItem item;
+                item.groupid = GroupId;
+                loot.items.push_back(item);
+            }
+
+            std::vector<uint32> hits(_entries.size() + 1);
+            for (uint32 i = 0; i < Samples; ++i)
+            {
+                LootStoreItem const* rolled = _template->RollGroup(GroupId, loot, _store, LOOT_MODE_DEFAULT, nullptr);
+                auto itr = std::find(_entries.begin(), _entries.end(), rolled);
+                ++hits[itr - _entries.begin()];
+            }
+
+            std::vector<double> shares;
+            for (uint32 count : hits)
+                shares.push_back(double(count) / Samples);
+
+            return shares;
+        }
+
+        void ExpectShares(std::vector<double> const& expected)
+        {
+            ASSERT_EQ(expected.size(), _entries.size() + 1);
+
+            for (bool compiled : { true, false })
+            {
+                std::vector<double> shares = RollShares(compiled);
+                for (std::size_t i = 0; i < expected.size(); ++i)
+                    EXPECT_NEAR(shares[i], expected[i], 0.01) << (compiled ? "compiled" : "sequential") << " roll, outcome " << i;
+            }
+        }
+
+    private:
+        void AddEntry(float chance)
+        {
+            auto item = new LootStoreItem(0, -int32(_entries.size() + 1), chance, false, LOOT_MODE_DEFAULT, GroupId, 1, 1);
+            _entries.push_back(item);
+            _template->AddEntry(item);
+        }
+
+        LootStore _store{ "test_loot_template", "entry", false };
+        std::unique_ptr<LootTemplate> _template;
+        std::vector<LootStoreItem const*> _entries;
+    };
+}
+
+TEST_F(LootGroupTest, ChancesBelowHundred)
+{
+    AddEntries({ 10.0f, 25.0f, 0.5f, 30.0f }, 2);
+
+    // what the explicit entries leave goes to the equal chanced entries
+    ExpectShares({ 0.10, 0.25, 0.005, 0.30, 0.1725, 0.1725, 0.0 });
+}
+
+TEST_F(LootGroupTest, ChancesAboveHundred)
+{
+    AddEntries({ 60.0f, 30.0f, 40.0f, 5.0f }, 1);
+
+    // later entries only get what is left of 100
+    ExpectShares({ 0.60, 0.30, 0.10, 0.0, 0.0, 0.0 });
+}
+
+TEST_F(LootGroupTest, GuaranteedEntry)
+{
+    AddEntries({ 20.0f, 100.0f, 50.0f }, 0);
+
+    ExpectShares({ 0.20, 0.80, 0.0, 0.0 });
+}
+
+TEST_F(LootGroupTest, EmptyDrop)
+{
+    AddEntries({ 10.0f, 15.0f }, 0);
+
+    ExpectShares({ 0.10, 0.15, 0.75 });
+}